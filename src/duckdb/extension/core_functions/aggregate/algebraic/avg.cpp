@@ -71,6 +71,16 @@ struct AverageSetOperation {
 	}
 };
 
+struct AverageRemoveSetOperation {
+	template <class STATE>
+	static void AddValues(STATE &state, idx_t count) {
+		state.count -= count;
+	}
+};
+
+//! The inverse of the integer averages, used for sliding window frames
+using AverageRemoveOperation = BaseSumOperation<AverageRemoveSetOperation, SubtractFromSum>;
+
 template <class T>
 static T GetAverageDivident(uint64_t count, optional_ptr<FunctionData> bind_data) {
 	T divident = T(count);
@@ -142,20 +152,32 @@ struct KahanAverageOperation : public BaseSumOperation<AverageSetOperation, Kaha
 AggregateFunction GetAverageAggregate(PhysicalType type) {
 	switch (type) {
 	case PhysicalType::INT16: {
-		return AggregateFunction::UnaryAggregate<AvgState<int64_t>, int16_t, double, IntegerAverageOperation>(
-		    LogicalType::SMALLINT, LogicalType::DOUBLE);
+		auto function =
+		    AggregateFunction::UnaryAggregate<AvgState<int64_t>, int16_t, double, IntegerAverageOperation>(
+		        LogicalType::SMALLINT, LogicalType::DOUBLE);
+		function.remove = AggregateFunction::UnaryUpdate<AvgState<int64_t>, int16_t, AverageRemoveOperation>;
+		return function;
 	}
 	case PhysicalType::INT32: {
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int32_t, double, IntegerAverageOperationHugeint>(
-		    LogicalType::INTEGER, LogicalType::DOUBLE);
+		auto function =
+		    AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int32_t, double, IntegerAverageOperationHugeint>(
+		        LogicalType::INTEGER, LogicalType::DOUBLE);
+		function.remove = AggregateFunction::UnaryUpdate<AvgState<hugeint_t>, int32_t, AverageRemoveOperation>;
+		return function;
 	}
 	case PhysicalType::INT64: {
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int64_t, double, IntegerAverageOperationHugeint>(
-		    LogicalType::BIGINT, LogicalType::DOUBLE);
+		auto function =
+		    AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int64_t, double, IntegerAverageOperationHugeint>(
+		        LogicalType::BIGINT, LogicalType::DOUBLE);
+		function.remove = AggregateFunction::UnaryUpdate<AvgState<hugeint_t>, int64_t, AverageRemoveOperation>;
+		return function;
 	}
 	case PhysicalType::INT128: {
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, hugeint_t, double, HugeintAverageOperation>(
-		    LogicalType::HUGEINT, LogicalType::DOUBLE);
+		auto function =
+		    AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, hugeint_t, double, HugeintAverageOperation>(
+		        LogicalType::HUGEINT, LogicalType::DOUBLE);
+		function.remove = AggregateFunction::UnaryUpdate<AvgState<hugeint_t>, hugeint_t, AverageRemoveOperation>;
+		return function;
 	}
 	default:
 		throw InternalException("Unimplemented average aggregate");
@@ -56,6 +56,9 @@ struct DoubleSumOperation : public BaseSumOperation<SumSetOperation, ADD_OPERATO
 	}
 };
 
+//! The inverse of the integer sums - the window aggregator resets the state once no values are left in the frame
+using SumRemoveOperation = BaseSumOperation<SumSetOperation, SubtractFromSum>;
+
 using NumericSumOperation = DoubleSumOperation<RegularAdd>;
 using KahanSumOperation = DoubleSumOperation<KahanAdd>;
 
@@ -161,6 +164,7 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int16_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::SMALLINT, LogicalType::HUGEINT);
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+		function.remove = AggregateFunction::UnaryUpdate<SumState<int64_t>, int16_t, SumRemoveOperation>;
 		return function;
 	}
 
@@ -170,6 +174,7 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		        LogicalType::INTEGER, LogicalType::HUGEINT);
 		function.statistics = SumPropagateStats;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+		function.remove = AggregateFunction::UnaryUpdate<SumState<hugeint_t>, int32_t, SumRemoveOperation>;
 		return function;
 	}
 	case PhysicalType::INT64: {
@@ -178,6 +183,7 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		        LogicalType::BIGINT, LogicalType::HUGEINT);
 		function.statistics = SumPropagateStats;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+		function.remove = AggregateFunction::UnaryUpdate<SumState<hugeint_t>, int64_t, SumRemoveOperation>;
 		return function;
 	}
 	case PhysicalType::INT128: {
@@ -185,6 +191,7 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, hugeint_t, hugeint_t, HugeintSumOperation>(
 		        LogicalType::HUGEINT, LogicalType::HUGEINT);
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+		function.remove = AggregateFunction::UnaryUpdate<SumState<hugeint_t>, hugeint_t, SumRemoveOperation>;
 		return function;
 	}
 	default:
@@ -235,6 +235,7 @@ unique_ptr<FunctionData> BindApproxQuantileDecimal(ClientContext &context, Aggre
 	auto bind_data = BindApproxQuantile(context, function, arguments);
 	function = GetApproximateQuantileDecimalAggregateFunction(arguments[0]->return_type);
 	function.name = "approx_quantile";
+	function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	function.serialize = ApproximateQuantileBindData::Serialize;
 	function.deserialize = ApproximateQuantileBindData::Deserialize;
 	return bind_data;
@@ -243,6 +244,7 @@ unique_ptr<FunctionData> BindApproxQuantileDecimal(ClientContext &context, Aggre
 AggregateFunction GetApproximateQuantileAggregate(const LogicalType &type) {
 	auto fun = GetApproximateQuantileAggregateFunction(type);
 	fun.bind = BindApproxQuantile;
+	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.serialize = ApproximateQuantileBindData::Serialize;
 	fun.deserialize = ApproximateQuantileBindData::Deserialize;
 	// temporarily push an argument so we can bind the actual quantile
@@ -298,6 +300,7 @@ AggregateFunction GetTypedApproxQuantileListAggregateFunction(const LogicalType
 	using STATE = ApproxQuantileState;
 	using OP = ApproxQuantileListOperation<INPUT_TYPE>;
 	auto fun = ApproxQuantileListAggregate<STATE, INPUT_TYPE, list_entry_t, OP>(type, type);
+	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.serialize = ApproximateQuantileBindData::Serialize;
 	fun.deserialize = ApproximateQuantileBindData::Deserialize;
 	return fun;
@@ -142,6 +142,21 @@ struct AddToHugeint {
 	}
 };
 
+//! Removes previously added values again (used for sliding window frames)
+struct SubtractFromSum {
+	template <class STATE, class T>
+	static void AddNumber(STATE &state, T input) {
+		state.value -= input;
+	}
+
+	template <class STATE, class T>
+	static void AddConstant(STATE &state, T input, idx_t count) {
+		for (idx_t i = 0; i < count; i++) {
+			state.value -= input;
+		}
+	}
+};
+
 template <class STATEOP, class ADDOP>
 struct BaseSumOperation {
 	template <class STATE>
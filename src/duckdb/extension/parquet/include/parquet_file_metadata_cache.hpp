@@ -21,8 +21,9 @@ public:
 	ParquetFileMetadataCache() : metadata(nullptr) {
 	}
 	ParquetFileMetadataCache(unique_ptr<duckdb_parquet::FileMetaData> file_metadata, time_t r_time,
-	                         unique_ptr<GeoParquetFileMetadata> geo_metadata)
-	    : metadata(std::move(file_metadata)), read_time(r_time), geo_metadata(std::move(geo_metadata)) {
+	                         unique_ptr<GeoParquetFileMetadata> geo_metadata, idx_t footer_size_p = 0)
+	    : metadata(std::move(file_metadata)), read_time(r_time), geo_metadata(std::move(geo_metadata)),
+	      footer_size(footer_size_p) {
 	}
 
 	~ParquetFileMetadataCache() override = default;
@@ -36,6 +37,9 @@ public:
 	//! GeoParquet metadata
 	unique_ptr<GeoParquetFileMetadata> geo_metadata;
 
+	//! Size of the serialized footer
+	idx_t footer_size;
+
 public:
 	static string ObjectType() {
 		return "parquet_metadata";
@@ -44,5 +48,19 @@ public:
 	string GetObjectType() override {
 		return ObjectType();
 	}
+
+	optional_idx GetEstimatedCacheMemory() const override {
+		if (!metadata) {
+			return optional_idx();
+		}
+		// the serialized footer size covers the variable-length parts (paths, statistics, key-value metadata)
+		// the fixed-size parts of the deserialized thrift objects are added on top of that
+		idx_t result = sizeof(ParquetFileMetadataCache) + sizeof(duckdb_parquet::FileMetaData) + footer_size;
+		result += metadata->schema.size() * sizeof(duckdb_parquet::SchemaElement);
+		for (auto &row_group : metadata->row_groups) {
+			result += sizeof(duckdb_parquet::RowGroup) + row_group.columns.size() * sizeof(duckdb_parquet::ColumnChunk);
+		}
+		return result;
+	}
 };
 } // namespace duckdb
@@ -13,6 +13,7 @@ vector<string> ListCompressionTypes(void) {
 	for (uint8_t i = 0; i < amount_of_compression_options; i++) {
 		compression_types.push_back(CompressionTypeToString((CompressionType)i));
 	}
+	compression_types.push_back(CompressionTypeToString(CompressionType::COMPRESSION_ZSTD));
 	return compression_types;
 }
 
@@ -44,6 +45,8 @@ CompressionType CompressionTypeFromString(const string &str) {
 		return CompressionType::COMPRESSION_ALP;
 	} else if (compression == "alprd") {
 		return CompressionType::COMPRESSION_ALPRD;
+	} else if (compression == "zstd") {
+		return CompressionType::COMPRESSION_ZSTD;
 	} else {
 		return CompressionType::COMPRESSION_AUTO;
 	}
@@ -75,6 +78,8 @@ string CompressionTypeToString(CompressionType type) {
 		return "ALP";
 	case CompressionType::COMPRESSION_ALPRD:
 		return "ALPRD";
+	case CompressionType::COMPRESSION_ZSTD:
+		return "ZSTD";
 	default:
 		throw InternalException("Unrecognized compression type!");
 	}
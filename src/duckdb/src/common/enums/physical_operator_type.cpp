@@ -43,6 +43,8 @@ string PhysicalOperatorToString(PhysicalOperatorType type) {
 		return "PERFECT_HASH_GROUP_BY";
 	case PhysicalOperatorType::PARTITIONED_AGGREGATE:
 		return "PARTITIONED_AGGREGATE";
+	case PhysicalOperatorType::STREAMING_AGGREGATE:
+		return "STREAMING_AGGREGATE";
 	case PhysicalOperatorType::FILTER:
 		return "FILTER";
 	case PhysicalOperatorType::PROJECTION:
@@ -67,6 +69,8 @@ string PhysicalOperatorToString(PhysicalOperatorType type) {
 		return "IE_JOIN";
 	case PhysicalOperatorType::ASOF_JOIN:
 		return "ASOF_JOIN";
+	case PhysicalOperatorType::INDEX_JOIN:
+		return "INDEX_JOIN";
 	case PhysicalOperatorType::CROSS_PRODUCT:
 		return "CROSS_PRODUCT";
 	case PhysicalOperatorType::POSITIONAL_JOIN:
@@ -1102,7 +1102,8 @@ void LocalFileSystem::FileSync(FileHandle &handle) {
 void LocalFileSystem::MoveFile(const string &source, const string &target, optional_ptr<FileOpener> opener) {
 	auto source_unicode = WindowsUtil::UTF8ToUnicode(source.c_str());
 	auto target_unicode = WindowsUtil::UTF8ToUnicode(target.c_str());
-	if (!MoveFileW(source_unicode.c_str(), target_unicode.c_str())) {
+	// like rename on POSIX, replace the target if it exists
+	if (!MoveFileExW(source_unicode.c_str(), target_unicode.c_str(), MOVEFILE_REPLACE_EXISTING)) {
 		throw IOException("Could not move file: %s", GetLastErrorAsString());
 	}
 }
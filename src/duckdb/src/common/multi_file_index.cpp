@@ -0,0 +1,450 @@
+#include "duckdb/common/multi_file_index.hpp"
+
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/multi_file_list.hpp"
+#include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/buffered_file_reader.hpp"
+#include "duckdb/common/serializer/buffered_file_writer.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+#include "duckdb/common/types/uuid.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/parser/tableref/table_function_ref.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+
+#include <chrono>
+#include <thread>
+
+namespace duckdb {
+
+bool MultiFileIndex::Enabled(ClientContext &context) {
+	return ClientConfig::GetConfig(context).enable_file_index;
+}
+
+string MultiFileIndex::GetIndexDirectory(const string &path) {
+	// the files of a glob are below the directory that precedes the first glob pattern
+	auto prefix = path.substr(0, path.find_first_of("*?["));
+	auto pos = prefix.find_last_of("/\\");
+	if (pos == string::npos) {
+		return string();
+	}
+	return prefix.substr(0, pos == 0 ? 1 : pos);
+}
+
+static string GetIndexPath(FileSystem &fs, const string &directory) {
+	if (directory.empty()) {
+		return MultiFileIndex::INDEX_FILE_NAME;
+	}
+	return fs.JoinPath(directory, MultiFileIndex::INDEX_FILE_NAME);
+}
+
+//! Returns the path of a file relative to a directory (or an empty string if the file is not below the directory)
+static string GetRelativePath(const string &directory, const string &path) {
+	if (directory.empty()) {
+		return path;
+	}
+	if (path.size() <= directory.size() || !StringUtil::StartsWith(path, directory)) {
+		return string();
+	}
+	auto start = directory.size();
+	if (directory.back() != '/' && directory.back() != '\\') {
+		if (path[start] != '/' && path[start] != '\\') {
+			return string();
+		}
+		start++;
+	}
+	return path.substr(start);
+}
+
+//===--------------------------------------------------------------------===//
+// Read/Write
+//===--------------------------------------------------------------------===//
+void MultiFileIndex::Read(FileSystem &fs, unique_ptr<FileHandle> handle) {
+	BufferedFileReader reader(fs, std::move(handle));
+	index_size = reader.FileSize();
+
+	BinaryDeserializer deserializer(reader);
+	deserializer.Begin();
+	auto version = deserializer.ReadProperty<idx_t>(100, "version");
+	if (version != INDEX_VERSION) {
+		throw IOException("Unsupported file index version %llu, re-create the file index", version);
+	}
+	deserializer.ReadList(101, "files", [&](Deserializer::List &list, idx_t i) {
+		list.ReadObject([&](Deserializer &file) {
+			auto path = file.ReadProperty<string>(100, "path");
+			auto &indexed_file = files[path];
+			auto &columns = indexed_file.columns;
+			file.ReadList(101, "columns", [&](Deserializer::List &column_list, idx_t column_idx) {
+				column_list.ReadObject([&](Deserializer &column) {
+					auto name = column.ReadProperty<string>(100, "name");
+					auto type = column.ReadProperty<LogicalType>(101, "type");
+					column.Set<const LogicalType &>(type);
+					auto stats = column.ReadProperty<BaseStatistics>(102, "statistics");
+					column.Unset<LogicalType>();
+					columns.emplace(std::move(name), std::move(stats));
+				});
+			});
+			indexed_file.file_size = file.ReadProperty<idx_t>(102, "file_size");
+			indexed_file.last_modified = static_cast<time_t>(file.ReadProperty<int64_t>(103, "last_modified"));
+		});
+	});
+	deserializer.End();
+}
+
+void MultiFileIndex::Write(ClientContext &context, const string &directory) const {
+	// the index is written to a temporary file first, so it is never read while it is incomplete
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto index_path = GetIndexPath(fs, directory);
+	auto tmp_path = index_path + ".tmp_" + UUID::ToString(UUID::GenerateRandomUUID());
+	BufferedFileWriter writer(fs, tmp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+
+	BinarySerializer serializer(writer);
+	serializer.Begin();
+	serializer.WriteProperty<idx_t>(100, "version", INDEX_VERSION);
+	auto file_entry = files.begin();
+	serializer.WriteList(101, "files", files.size(), [&](Serializer::List &list, idx_t i) {
+		list.WriteObject([&](Serializer &file) {
+			file.WriteProperty(100, "path", file_entry->first);
+			auto &columns = file_entry->second.columns;
+			auto column_entry = columns.begin();
+			file.WriteList(101, "columns", columns.size(), [&](Serializer::List &column_list, idx_t column_idx) {
+				column_list.WriteObject([&](Serializer &column) {
+					column.WriteProperty(100, "name", column_entry->first);
+					column.WriteProperty(101, "type", column_entry->second.GetType());
+					column.WriteProperty(102, "statistics", column_entry->second);
+				});
+				column_entry++;
+			});
+			file.WriteProperty<idx_t>(102, "file_size", file_entry->second.file_size);
+			file.WriteProperty<int64_t>(103, "last_modified", static_cast<int64_t>(file_entry->second.last_modified));
+		});
+		file_entry++;
+	});
+	serializer.End();
+	writer.Sync();
+	writer.Close();
+
+	// the rename replaces the previous index
+	fs.MoveFile(tmp_path, index_path);
+}
+
+shared_ptr<MultiFileIndex> MultiFileIndex::TryLoad(ClientContext &context, const string &directory) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto index_path = GetIndexPath(fs, directory);
+	auto handle = fs.OpenFile(index_path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+	if (!handle) {
+		return nullptr;
+	}
+	auto last_modified = fs.GetLastModifiedTime(*handle);
+	auto file_size = NumericCast<idx_t>(fs.GetFileSize(*handle));
+	auto cache_enabled = ObjectCache::ObjectCacheEnabled(context);
+	if (cache_enabled) {
+		auto cached = ObjectCache::GetObjectCache(context).Get<MultiFileIndex>(index_path);
+		if (cached && cached->last_modified == last_modified && cached->index_size == file_size) {
+			return cached;
+		}
+	}
+	auto result = make_shared_ptr<MultiFileIndex>();
+	result->last_modified = last_modified;
+	result->Read(fs, std::move(handle));
+	if (cache_enabled) {
+		ObjectCache::GetObjectCache(context).Put(index_path, result);
+	}
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// Create
+//===--------------------------------------------------------------------===//
+void MultiFileIndex::AddFile(ClientContext &context, TableFunction &reader, const string &path,
+                             const string &relative_path) {
+	// bind the reader on the file: this only reads its metadata
+	vector<Value> inputs {Value(path)};
+	named_parameter_map_t named_parameters;
+	if (reader.named_parameters.find("hive_partitioning") != reader.named_parameters.end()) {
+		// we want the statistics of the columns in the file
+		named_parameters["hive_partitioning"] = Value::BOOLEAN(false);
+	}
+	vector<LogicalType> input_table_types;
+	vector<string> input_table_names;
+	TableFunctionRef ref;
+	TableFunctionBindInput input(inputs, named_parameters, input_table_types, input_table_names,
+	                             reader.function_info.get(), nullptr, reader, ref);
+	vector<LogicalType> types;
+	vector<string> names;
+
+	// the size and modification time are read before the statistics: a change in between is detected when pruning
+	auto &indexed_file = files[relative_path];
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+	indexed_file.file_size = NumericCast<idx_t>(fs.GetFileSize(*handle));
+	indexed_file.last_modified = fs.GetLastModifiedTime(*handle);
+	handle.reset();
+
+	auto bind_data = reader.bind(context, input, types, names);
+	auto &columns = indexed_file.columns;
+	columns.clear();
+	for (idx_t col_idx = 0; col_idx < names.size(); col_idx++) {
+		auto stats = reader.statistics(context, bind_data.get(), col_idx);
+		if (stats) {
+			columns.emplace(names[col_idx], std::move(*stats));
+		}
+	}
+}
+
+//! Modification times have a granularity of a second: a file that is changed again in the second in which it was
+//! indexed would keep the modification time that is in the index. Wait until the last modification of the files is in
+//! the past, so that every later change is visible.
+static void WaitForModifications(FileSystem &fs, const vector<string> &paths) {
+	int64_t last_modified = 0;
+	for (auto &path : paths) {
+		auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+		last_modified = MaxValue<int64_t>(last_modified, static_cast<int64_t>(fs.GetLastModifiedTime(*handle)));
+	}
+	// the modification times of remote files come from another clock: do not wait for a clock that is ahead
+	auto deadline = Timestamp::GetEpochSeconds(Timestamp::GetCurrentTimestamp()) + 2;
+	while (true) {
+		auto now = Timestamp::GetEpochSeconds(Timestamp::GetCurrentTimestamp());
+		if (now > last_modified || now > deadline) {
+			return;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+}
+
+void MultiFileIndex::IndexFiles(ClientContext &context, const string &directory, TableFunction &reader,
+                                const vector<string> &paths) {
+	if (!reader.bind || !reader.statistics) {
+		throw NotImplementedException("Cannot create a file index: \"%s\" does not provide file statistics",
+		                              reader.name);
+	}
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto index_path = GetIndexPath(fs, directory);
+
+	// files are added to the existing index of the directory
+	MultiFileIndex index;
+	auto handle = fs.OpenFile(index_path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+	if (handle) {
+		index.Read(fs, std::move(handle));
+	}
+	WaitForModifications(fs, paths);
+	for (auto &path : paths) {
+		auto relative_path = GetRelativePath(directory, path);
+		if (relative_path.empty()) {
+			throw InvalidInputException("Cannot add \"%s\" to the file index of \"%s\": the file is not below it",
+			                            path, directory);
+		}
+		index.AddFile(context, reader, path, relative_path);
+	}
+	index.Write(context, directory);
+	if (ObjectCache::ObjectCacheEnabled(context)) {
+		ObjectCache::GetObjectCache(context).Delete(index_path);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Pruning
+//===--------------------------------------------------------------------===//
+optional_ptr<BaseStatistics> MultiFileIndex::GetStatistics(const string &relative_path, const string &column_name) {
+	auto file_entry = files.find(relative_path);
+	if (file_entry == files.end()) {
+		return nullptr;
+	}
+	auto &columns = file_entry->second.columns;
+	auto column_entry = columns.find(column_name);
+	if (column_entry == columns.end()) {
+		return nullptr;
+	}
+	return &column_entry->second;
+}
+
+bool MultiFileIndex::IsUnchanged(FileSystem &fs, const string &path, const string &relative_path) const {
+	auto file_entry = files.find(relative_path);
+	if (file_entry == files.end()) {
+		return false;
+	}
+	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+	if (!handle) {
+		return false;
+	}
+	auto &indexed_file = file_entry->second;
+	return NumericCast<idx_t>(fs.GetFileSize(*handle)) == indexed_file.file_size &&
+	       fs.GetLastModifiedTime(*handle) == indexed_file.last_modified;
+}
+
+//! Checks filters against the statistics of a file in the index
+struct FileStatisticsFilter {
+	FileStatisticsFilter(MultiFileIndex &index, const string &relative_path, const MultiFilePushdownInfo &info)
+	    : index(index), relative_path(relative_path), info(info) {
+	}
+
+	MultiFileIndex &index;
+	const string &relative_path;
+	const MultiFilePushdownInfo &info;
+
+	optional_ptr<BaseStatistics> GetStatistics(const Expression &expr) {
+		if (expr.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+			return nullptr;
+		}
+		auto &colref = expr.Cast<BoundColumnRefExpression>();
+		if (colref.binding.table_index != info.table_index || colref.binding.column_index >= info.column_ids.size()) {
+			return nullptr;
+		}
+		auto column_id = info.column_ids[colref.binding.column_index];
+		if (IsRowIdColumnId(column_id) || column_id >= info.column_names.size()) {
+			return nullptr;
+		}
+		auto stats = index.GetStatistics(relative_path, info.column_names[column_id]);
+		if (!stats || stats->GetType() != expr.return_type) {
+			// the type of the column in this scan differs from the type in the file
+			return nullptr;
+		}
+		return stats;
+	}
+
+	//! Returns true if the filter is false for all rows of the file
+	bool ExcludesFile(const Expression &filter) {
+		switch (filter.GetExpressionClass()) {
+		case ExpressionClass::BOUND_CONJUNCTION: {
+			auto &conjunction = filter.Cast<BoundConjunctionExpression>();
+			for (auto &child : conjunction.children) {
+				auto excludes = ExcludesFile(*child);
+				if (excludes && filter.GetExpressionType() == ExpressionType::CONJUNCTION_AND) {
+					return true;
+				}
+				if (!excludes && filter.GetExpressionType() == ExpressionType::CONJUNCTION_OR) {
+					return false;
+				}
+			}
+			return filter.GetExpressionType() == ExpressionType::CONJUNCTION_OR;
+		}
+		case ExpressionClass::BOUND_COMPARISON: {
+			auto &comparison = filter.Cast<BoundComparisonExpression>();
+			auto comparison_type = comparison.GetExpressionType();
+			switch (comparison_type) {
+			case ExpressionType::COMPARE_EQUAL:
+			case ExpressionType::COMPARE_NOTEQUAL:
+			case ExpressionType::COMPARE_LESSTHAN:
+			case ExpressionType::COMPARE_GREATERTHAN:
+			case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+				break;
+			default:
+				return false;
+			}
+			auto column = comparison.left.get();
+			auto constant = comparison.right.get();
+			if (constant->GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+				std::swap(column, constant);
+				comparison_type = FlipComparisonExpression(comparison_type);
+			}
+			if (constant->GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+				return false;
+			}
+			auto stats = GetStatistics(*column);
+			if (!stats) {
+				return false;
+			}
+			if (!stats->CanHaveNoNull()) {
+				// the column only contains NULL values
+				return true;
+			}
+			auto &value = constant->Cast<BoundConstantExpression>().value;
+			if (value.type() != stats->GetType()) {
+				return false;
+			}
+			ConstantFilter constant_filter(comparison_type, value);
+			return constant_filter.CheckStatistics(*stats) == FilterPropagateResult::FILTER_ALWAYS_FALSE;
+		}
+		case ExpressionClass::BOUND_OPERATOR: {
+			auto &op = filter.Cast<BoundOperatorExpression>();
+			if (op.children.size() != 1) {
+				return false;
+			}
+			auto stats = GetStatistics(*op.children[0]);
+			if (!stats) {
+				return false;
+			}
+			if (filter.GetExpressionType() == ExpressionType::OPERATOR_IS_NULL) {
+				return !stats->CanHaveNull();
+			}
+			if (filter.GetExpressionType() == ExpressionType::OPERATOR_IS_NOT_NULL) {
+				return !stats->CanHaveNoNull();
+			}
+			return false;
+		}
+		default:
+			return false;
+		}
+	}
+};
+
+void MultiFileIndex::ApplyFiltersToFileList(ClientContext &context, const vector<string> &paths,
+                                            vector<string> &files, const vector<unique_ptr<Expression>> &filters,
+                                            MultiFilePushdownInfo &info) {
+	if (filters.empty() || files.empty()) {
+		return;
+	}
+	// load the indexes of the directories of the scanned paths
+	unordered_set<string> directories;
+	vector<pair<string, shared_ptr<MultiFileIndex>>> indexes;
+	for (auto &path : paths) {
+		auto directory = GetIndexDirectory(path);
+		if (!directories.insert(directory).second) {
+			continue;
+		}
+		auto index = TryLoad(context, directory);
+		if (index) {
+			indexes.emplace_back(std::move(directory), std::move(index));
+		}
+	}
+	if (indexes.empty()) {
+		return;
+	}
+
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto check_changes = ClientConfig::GetConfig(context).file_index_check_changes;
+	vector<string> result;
+	for (auto &file : files) {
+		bool excluded = false;
+		for (auto &entry : indexes) {
+			auto relative_path = GetRelativePath(entry.first, file);
+			if (relative_path.empty()) {
+				continue;
+			}
+			FileStatisticsFilter statistics_filter(*entry.second, relative_path, info);
+			for (auto &filter : filters) {
+				if (statistics_filter.ExcludesFile(*filter)) {
+					excluded = true;
+					break;
+				}
+			}
+			if (excluded && check_changes && !entry.second->IsUnchanged(fs, file, relative_path)) {
+				// the file was changed after it was indexed: its statistics cannot be used
+				excluded = false;
+			}
+			break;
+		}
+		if (!excluded) {
+			result.push_back(file);
+		}
+	}
+	if (result.size() == files.size()) {
+		return;
+	}
+	if (!info.extra_info.total_files.IsValid()) {
+		info.extra_info.total_files = files.size();
+	}
+	info.extra_info.filtered_files = result.size();
+	files = std::move(result);
+}
+
+} // namespace duckdb
@@ -2,6 +2,7 @@
 
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
+#include "duckdb/common/multi_file_index.hpp"
 #include "duckdb/common/types.hpp"
 #include "duckdb/function/function_set.hpp"
 #include "duckdb/function/table_function.hpp"
@@ -26,9 +27,16 @@ MultiFilePushdownInfo::MultiFilePushdownInfo(idx_t table_index, const vector<str
     : table_index(table_index), column_names(column_names), column_ids(column_ids), extra_info(extra_info) {
 }
 
+//! Whether filters can prune the files of a MultiFileList: on their hive partitions or file names, or on the column
+//! statistics in a file index
+static bool CanPruneFiles(ClientContext &context, const MultiFileReaderOptions &options) {
+	return options.hive_partitioning || options.filename || MultiFileIndex::Enabled(context);
+}
+
 // Helper method to do Filter Pushdown into a MultiFileList
 bool PushdownInternal(ClientContext &context, const MultiFileReaderOptions &options, MultiFilePushdownInfo &info,
-                      vector<unique_ptr<Expression>> &filters, vector<string> &expanded_files) {
+                      vector<unique_ptr<Expression>> &filters, const vector<string> &paths,
+                      vector<string> &expanded_files) {
 	HivePartitioningFilterInfo filter_info;
 	for (idx_t i = 0; i < info.column_ids.size(); i++) {
 		if (!IsRowIdColumnId(info.column_ids[i])) {
@@ -40,6 +48,9 @@ bool PushdownInternal(ClientContext &context, const MultiFileReaderOptions &opti
 
 	auto start_files = expanded_files.size();
 	HivePartitioning::ApplyFiltersToFileList(context, expanded_files, filters, filter_info, info);
+	if (MultiFileIndex::Enabled(context)) {
+		MultiFileIndex::ApplyFiltersToFileList(context, paths, expanded_files, filters, info);
+	}
 
 	if (expanded_files.size() != start_files) {
 		return true;
@@ -50,7 +61,7 @@ bool PushdownInternal(ClientContext &context, const MultiFileReaderOptions &opti
 
 bool PushdownInternal(ClientContext &context, const MultiFileReaderOptions &options, const vector<string> &names,
                       const vector<LogicalType> &types, const vector<column_t> &column_ids,
-                      const TableFilterSet &filters, vector<string> &expanded_files) {
+                      const TableFilterSet &filters, const vector<string> &paths, vector<string> &expanded_files) {
 	idx_t table_index = 0;
 	ExtraOperatorInfo extra_info;
 
@@ -68,7 +79,7 @@ bool PushdownInternal(ClientContext &context, const MultiFileReaderOptions &opti
 	}
 
 	// call the original PushdownInternal method
-	return PushdownInternal(context, options, info, filter_expressions, expanded_files);
+	return PushdownInternal(context, options, info, filter_expressions, paths, expanded_files);
 }
 
 //===--------------------------------------------------------------------===//
@@ -199,13 +210,13 @@ unique_ptr<MultiFileList> SimpleMultiFileList::ComplexFilterPushdown(ClientConte
                                                                      const MultiFileReaderOptions &options,
                                                                      MultiFilePushdownInfo &info,
                                                                      vector<unique_ptr<Expression>> &filters) {
-	if (!options.hive_partitioning && !options.filename) {
+	if (!CanPruneFiles(context_p, options)) {
 		return nullptr;
 	}
 
 	// FIXME: don't copy list until first file is filtered
 	auto file_copy = paths;
-	auto res = PushdownInternal(context_p, options, info, filters, file_copy);
+	auto res = PushdownInternal(context_p, options, info, filters, paths, file_copy);
 
 	if (res) {
 		return make_uniq<SimpleMultiFileList>(file_copy);
@@ -218,13 +229,13 @@ unique_ptr<MultiFileList>
 SimpleMultiFileList::DynamicFilterPushdown(ClientContext &context, const MultiFileReaderOptions &options,
                                            const vector<string> &names, const vector<LogicalType> &types,
                                            const vector<column_t> &column_ids, TableFilterSet &filters) const {
-	if (!options.hive_partitioning && !options.filename) {
+	if (!CanPruneFiles(context, options)) {
 		return nullptr;
 	}
 
 	// FIXME: don't copy list until first file is filtered
 	auto file_copy = paths;
-	auto res = PushdownInternal(context, options, names, types, column_ids, filters, file_copy);
+	auto res = PushdownInternal(context, options, names, types, column_ids, filters, paths, file_copy);
 	if (res) {
 		return make_uniq<SimpleMultiFileList>(file_copy);
 	}
@@ -277,10 +288,10 @@ unique_ptr<MultiFileList> GlobMultiFileList::ComplexFilterPushdown(ClientContext
 	while (ExpandNextPath()) {
 	}
 
-	if (!options.hive_partitioning && !options.filename) {
+	if (!CanPruneFiles(context, options)) {
 		return nullptr;
 	}
-	auto res = PushdownInternal(context, options, info, filters, expanded_files);
+	auto res = PushdownInternal(context, options, info, filters, paths, expanded_files);
 	if (res) {
 		return make_uniq<SimpleMultiFileList>(expanded_files);
 	}
@@ -292,7 +303,7 @@ unique_ptr<MultiFileList>
 GlobMultiFileList::DynamicFilterPushdown(ClientContext &context, const MultiFileReaderOptions &options,
                                          const vector<string> &names, const vector<LogicalType> &types,
                                          const vector<column_t> &column_ids, TableFilterSet &filters) const {
-	if (!options.hive_partitioning && !options.filename) {
+	if (!CanPruneFiles(context, options)) {
 		return nullptr;
 	}
 	lock_guard<mutex> lck(lock);
@@ -304,7 +315,7 @@ GlobMultiFileList::DynamicFilterPushdown(ClientContext &context, const MultiFile
 	while (ExpandPathInternal(path_index, file_list)) {
 	}
 
-	auto res = PushdownInternal(context, options, names, types, column_ids, filters, file_list);
+	auto res = PushdownInternal(context, options, names, types, column_ids, filters, paths, file_list);
 	if (res) {
 		return make_uniq<SimpleMultiFileList>(file_list);
 	}
@@ -177,9 +177,31 @@ inline void InsertionSort(const data_ptr_t orig_ptr, const data_ptr_t temp_ptr,
 	}
 }
 
+//! Calls pdqsort on the rows, comparing the key bytes from the given offset onwards
+static void PDQSort(const data_ptr_t dataptr, const idx_t &count, const idx_t &col_offset, const idx_t &row_width,
+                    const idx_t &comp_width, const idx_t &offset) {
+	auto begin = duckdb_pdqsort::PDQIterator(dataptr, row_width);
+	auto end = begin + count;
+	duckdb_pdqsort::PDQConstants constants(row_width, col_offset + offset, comp_width - offset, *end);
+	duckdb_pdqsort::pdqsort_branchless(begin, end, constants);
+}
+
+//! Calls pdqsort on a bucket of the MSD radix sort, moving the result to the original array
+inline void PDQSortBucket(const data_ptr_t orig_ptr, const data_ptr_t temp_ptr, const idx_t &count,
+                          const idx_t &col_offset, const idx_t &row_width, const idx_t &comp_width, const idx_t &offset,
+                          bool swap) {
+	const data_ptr_t source_ptr = swap ? temp_ptr : orig_ptr;
+	PDQSort(source_ptr, count, col_offset, row_width, comp_width, offset);
+	if (swap) {
+		memcpy(orig_ptr, source_ptr, count * row_width);
+	}
+}
+
 //! MSD radix sort that switches to insertion sort with low bucket sizes
+//! If a bucket threshold is given, buckets up to that count are sorted with pdqsort instead of recursing further
 void RadixSortMSD(const data_ptr_t orig_ptr, const data_ptr_t temp_ptr, const idx_t &count, const idx_t &col_offset,
-                  const idx_t &row_width, const idx_t &comp_width, const idx_t &offset, idx_t locations[], bool swap) {
+                  const idx_t &row_width, const idx_t &comp_width, const idx_t &offset, idx_t locations[], bool swap,
+                  const idx_t &bucket_threshold) {
 	const data_ptr_t source_ptr = swap ? temp_ptr : orig_ptr;
 	const data_ptr_t target_ptr = swap ? orig_ptr : temp_ptr;
 	// Init counts to 0
@@ -217,16 +239,20 @@ void RadixSortMSD(const data_ptr_t orig_ptr, const data_ptr_t temp_ptr, const id
 	}
 	if (max_count == count) {
 		RadixSortMSD(orig_ptr, temp_ptr, count, col_offset, row_width, comp_width, offset + 1,
-		             locations + SortConstants::MSD_RADIX_LOCATIONS, swap);
+		             locations + SortConstants::MSD_RADIX_LOCATIONS, swap, bucket_threshold);
 		return;
 	}
 	// Recurse
+	const idx_t radix_threshold = MaxValue<idx_t>(bucket_threshold, SortConstants::INSERTION_SORT_THRESHOLD);
 	idx_t radix_count = locations[0];
 	for (idx_t radix = 0; radix < SortConstants::VALUES_PER_RADIX; radix++) {
 		const idx_t loc = (locations[radix] - radix_count) * row_width;
-		if (radix_count > SortConstants::INSERTION_SORT_THRESHOLD) {
+		if (radix_count > radix_threshold) {
 			RadixSortMSD(orig_ptr + loc, temp_ptr + loc, radix_count, col_offset, row_width, comp_width, offset + 1,
-			             locations + SortConstants::MSD_RADIX_LOCATIONS, swap);
+			             locations + SortConstants::MSD_RADIX_LOCATIONS, swap, bucket_threshold);
+		} else if (radix_count > SortConstants::INSERTION_SORT_THRESHOLD) {
+			PDQSortBucket(orig_ptr + loc, temp_ptr + loc, radix_count, col_offset, row_width, comp_width, offset + 1,
+			              swap);
 		} else if (radix_count != 0) {
 			InsertionSort(orig_ptr + loc, temp_ptr + loc, radix_count, col_offset, row_width, comp_width, offset + 1,
 			              swap);
@@ -239,18 +265,20 @@ void RadixSortMSD(const data_ptr_t orig_ptr, const data_ptr_t temp_ptr, const id
 void RadixSort(BufferManager &buffer_manager, const data_ptr_t &dataptr, const idx_t &count, const idx_t &col_offset,
                const idx_t &sorting_size, const SortLayout &sort_layout, bool contains_string) {
 
+	idx_t bucket_threshold = 0;
 	if (contains_string) {
-		auto begin = duckdb_pdqsort::PDQIterator(dataptr, sort_layout.entry_size);
-		auto end = begin + count;
-		duckdb_pdqsort::PDQConstants constants(sort_layout.entry_size, col_offset, sorting_size, *end);
-		return duckdb_pdqsort::pdqsort_branchless(begin, begin + count, constants);
-	}
-
-	if (count <= SortConstants::INSERTION_SORT_THRESHOLD) {
+		// string prefixes are sorted with pdqsort - but large inputs are first radix partitioned on their leading
+		// bytes until the partitions fit in cache, which saves pdqsort many passes over the whole input
+		bucket_threshold = MaxValue<idx_t>(SortConstants::STRING_RADIX_PARTITION_SIZE / sort_layout.entry_size,
+		                                   SortConstants::INSERTION_SORT_THRESHOLD);
+		if (count <= bucket_threshold) {
+			return PDQSort(dataptr, count, col_offset, sort_layout.entry_size, sorting_size, 0);
+		}
+	} else if (count <= SortConstants::INSERTION_SORT_THRESHOLD) {
 		return InsertionSort(dataptr, nullptr, count, col_offset, sort_layout.entry_size, sorting_size, 0, false);
 	}
 
-	if (sorting_size <= SortConstants::MSD_RADIX_SORT_SIZE_THRESHOLD) {
+	if (!contains_string && sorting_size <= SortConstants::MSD_RADIX_SORT_SIZE_THRESHOLD) {
 		return RadixSortLSD(buffer_manager, dataptr, count, col_offset, sort_layout.entry_size, sorting_size);
 	}
 
@@ -260,7 +288,7 @@ void RadixSort(BufferManager &buffer_manager, const data_ptr_t &dataptr, const i
 	auto pre_allocated_array =
 	    make_unsafe_uniq_array_uninitialized<idx_t>(sorting_size * SortConstants::MSD_RADIX_LOCATIONS);
 	RadixSortMSD(dataptr, temp_block.Ptr(), count, col_offset, sort_layout.entry_size, sorting_size, 0,
-	             pre_allocated_array.get(), false);
+	             pre_allocated_array.get(), false, bucket_threshold);
 }
 
 //! Identifies sequences of rows that are tied, and calls radix sort on these
@@ -15,8 +15,9 @@ uint32_t ChunkReference::GetMinimumBlockID() const {
 	return *std::min_element(block_ids.begin(), block_ids.end());
 }
 
-ColumnDataConsumer::ColumnDataConsumer(ColumnDataCollection &collection_p, vector<column_t> column_ids)
-    : collection(collection_p), column_ids(std::move(column_ids)) {
+ColumnDataConsumer::ColumnDataConsumer(ColumnDataCollection &collection_p, vector<column_t> column_ids,
+                                       bool consume)
+    : collection(collection_p), column_ids(std::move(column_ids)), consume(consume) {
 }
 
 void ColumnDataConsumer::InitializeScan() {
@@ -72,7 +73,9 @@ void ColumnDataConsumer::FinishChunk(ColumnDataConsumerScanState &state) {
 		chunks_in_progress.erase(state.chunk_index);
 		chunk_delete_index = delete_index_end;
 	}
-	ConsumeChunks(delete_index_start, delete_index_end);
+	if (consume) {
+		ConsumeChunks(delete_index_start, delete_index_end);
+	}
 }
 void ColumnDataConsumer::ConsumeChunks(idx_t delete_index_start, idx_t delete_index_end) {
 	for (idx_t chunk_index = delete_index_start; chunk_index < delete_index_end; chunk_index++) {
@@ -1,113 +1,318 @@
 #include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
 #include "duckdb/execution/adaptive_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/optional_filter.hpp"
+#include "duckdb/planner/filter/struct_filter.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+#include "duckdb/storage/statistics/struct_stats.hpp"
 #include "duckdb/common/numeric_utils.hpp"
 #include "duckdb/common/vector.hpp"
 
 namespace duckdb {
 
-AdaptiveFilter::AdaptiveFilter(const Expression &expr) : observe_interval(10), execute_interval(20), warmup(true) {
+//! The amount of chunks in a sampling window
+static constexpr idx_t ADAPTIVE_FILTER_OBSERVE_INTERVAL = 4;
+//! The amount of chunks between sampling windows after the order has changed
+static constexpr idx_t ADAPTIVE_FILTER_MIN_EXECUTE_INTERVAL = 16;
+//! The maximum amount of chunks between sampling windows while the order is stable
+static constexpr idx_t ADAPTIVE_FILTER_MAX_EXECUTE_INTERVAL = 1024;
+//! A new order is only used if its expected cost is lower than this fraction of the current order
+static constexpr double ADAPTIVE_FILTER_REORDER_THRESHOLD = 0.95;
+
+static double EstimateComparisonSelectivity(ExpressionType comparison_type) {
+	switch (comparison_type) {
+	case ExpressionType::COMPARE_EQUAL:
+	case ExpressionType::COMPARE_NOT_DISTINCT_FROM:
+		return 0.1;
+	case ExpressionType::COMPARE_NOTEQUAL:
+	case ExpressionType::COMPARE_DISTINCT_FROM:
+		return 0.9;
+	default:
+		return 0.33;
+	}
+}
+
+static void EstimateExpression(const Expression &expr, double &selectivity) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_COMPARISON:
+		selectivity = EstimateComparisonSelectivity(expr.type);
+		break;
+	case ExpressionClass::BOUND_OPERATOR:
+		if (expr.type == ExpressionType::OPERATOR_IS_NULL) {
+			selectivity = 0.1;
+		} else if (expr.type == ExpressionType::OPERATOR_IS_NOT_NULL) {
+			selectivity = 0.9;
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+//! Estimates the fraction of the range [min, max] of the column that passes the comparison with the constant
+static bool EstimateRangeSelectivity(const ConstantFilter &filter, const BaseStatistics &stats, double &selectivity) {
+	auto &type = filter.constant.type();
+	if (!type.IsNumeric() || filter.constant.IsNull() || stats.GetStatsType() != StatisticsType::NUMERIC_STATS ||
+	    !NumericStats::HasMinMax(stats)) {
+		return false;
+	}
+	double min, max, constant;
+	try {
+		min = NumericStats::Min(stats).GetValue<double>();
+		max = NumericStats::Max(stats).GetValue<double>();
+		constant = filter.constant.GetValue<double>();
+	} catch (std::exception &) {
+		return false;
+	}
+	if (!(max > min)) {
+		return false;
+	}
+	double below = MaxValue<double>(0, MinValue<double>(1, (constant - min) / (max - min)));
+	switch (filter.comparison_type) {
+	case ExpressionType::COMPARE_LESSTHAN:
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		selectivity = below;
+		return true;
+	case ExpressionType::COMPARE_GREATERTHAN:
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		selectivity = 1 - below;
+		return true;
+	default:
+		return false;
+	}
+}
+
+static void EstimateTableFilter(const TableFilter &filter, optional_ptr<const BaseStatistics> stats, double &cost,
+                                double &selectivity) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		cost = constant_filter.constant.type().InternalType() == PhysicalType::VARCHAR ? 4.0 : 1.0;
+		selectivity = EstimateComparisonSelectivity(constant_filter.comparison_type);
+		if (stats) {
+			if (!EstimateRangeSelectivity(constant_filter, *stats, selectivity) &&
+			    constant_filter.comparison_type == ExpressionType::COMPARE_EQUAL) {
+				auto distinct_count = stats->GetDistinctCount();
+				if (distinct_count > 0) {
+					selectivity = 1.0 / static_cast<double>(distinct_count);
+				}
+			}
+		}
+		break;
+	}
+	case TableFilterType::IS_NULL:
+		cost = 0.5;
+		selectivity = stats && !stats->CanHaveNull() ? 0.0 : 0.1;
+		break;
+	case TableFilterType::IS_NOT_NULL:
+		cost = 0.5;
+		selectivity = stats && !stats->CanHaveNull() ? 1.0 : 0.9;
+		break;
+	case TableFilterType::CONJUNCTION_AND:
+	case TableFilterType::CONJUNCTION_OR: {
+		bool is_and = filter.filter_type == TableFilterType::CONJUNCTION_AND;
+		auto &child_filters = is_and ? filter.Cast<ConjunctionAndFilter>().child_filters
+		                             : filter.Cast<ConjunctionOrFilter>().child_filters;
+		// assume independent predicates
+		double fraction = 1.0;
+		cost = 0;
+		for (auto &child_filter : child_filters) {
+			double child_cost, child_selectivity;
+			EstimateTableFilter(*child_filter, stats, child_cost, child_selectivity);
+			cost += child_cost;
+			fraction *= is_and ? child_selectivity : 1 - child_selectivity;
+		}
+		selectivity = is_and ? fraction : 1 - fraction;
+		break;
+	}
+	case TableFilterType::STRUCT_EXTRACT: {
+		auto &struct_filter = filter.Cast<StructFilter>();
+		optional_ptr<const BaseStatistics> child_stats;
+		if (stats && stats->GetStatsType() == StatisticsType::STRUCT_STATS) {
+			child_stats = StructStats::GetChildStats(*stats, struct_filter.child_idx);
+		}
+		EstimateTableFilter(*struct_filter.child_filter, child_stats, cost, selectivity);
+		cost += 0.5;
+		break;
+	}
+	case TableFilterType::OPTIONAL_FILTER:
+		// optional filters are only used for pruning - they are not evaluated
+		cost = 0.0;
+		selectivity = 1.0;
+		break;
+	default:
+		cost = 1.0;
+		selectivity = 0.5;
+		break;
+	}
+}
+
+AdaptiveFilter::AdaptiveFilter(const Expression &expr)
+    : observe_interval(ADAPTIVE_FILTER_OBSERVE_INTERVAL), execute_interval(ADAPTIVE_FILTER_MIN_EXECUTE_INTERVAL) {
 	auto &conj_expr = expr.Cast<BoundConjunctionExpression>();
 	D_ASSERT(conj_expr.children.size() > 1);
+	is_or = conj_expr.type == ExpressionType::CONJUNCTION_OR;
+	predicates.resize(conj_expr.children.size());
 	for (idx_t idx = 0; idx < conj_expr.children.size(); idx++) {
 		permutation.push_back(idx);
 		if (conj_expr.children[idx]->CanThrow()) {
 			disable_permutations = true;
 		}
-		if (idx != conj_expr.children.size() - 1) {
-			swap_likeliness.push_back(100);
-		}
+		// the optimizer already ordered the children by their estimated cost
+		auto &predicate = predicates[idx];
+		predicate.cost = static_cast<double>(idx + 1);
+		EstimateExpression(*conj_expr.children[idx], predicate.selectivity);
 	}
-	right_random_border = 100 * (conj_expr.children.size() - 1);
+	Reorder();
 }
 
 AdaptiveFilter::AdaptiveFilter(const TableFilterSet &table_filters)
-    : observe_interval(10), execute_interval(20), warmup(true) {
-	for (idx_t idx = 0; idx < table_filters.filters.size(); idx++) {
+    : observe_interval(ADAPTIVE_FILTER_OBSERVE_INTERVAL), execute_interval(ADAPTIVE_FILTER_MIN_EXECUTE_INTERVAL) {
+	predicates.resize(table_filters.filters.size());
+	idx_t idx = 0;
+	for (auto &entry : table_filters.filters) {
 		permutation.push_back(idx);
-		swap_likeliness.push_back(100);
+		auto &predicate = predicates[idx];
+		EstimateTableFilter(*entry.second, nullptr, predicate.cost, predicate.selectivity);
+		idx++;
 	}
-	swap_likeliness.pop_back();
-	right_random_border = 100 * (table_filters.filters.size() - 1);
+	seeded = false;
+	Reorder();
 }
 
-AdaptiveFilterState AdaptiveFilter::BeginFilter() const {
-	if (permutation.size() <= 1 || disable_permutations) {
-		return AdaptiveFilterState();
+void AdaptiveFilter::SeedStatistics(idx_t predicate_idx, const TableFilter &filter, const BaseStatistics &stats) {
+	D_ASSERT(predicate_idx < predicates.size());
+	auto &predicate = predicates[predicate_idx];
+	if (predicate.measured) {
+		return;
 	}
+	EstimateTableFilter(filter, stats, predicate.cost, predicate.selectivity);
+}
+
+void AdaptiveFilter::FinishSeeding() {
+	seeded = true;
+	Reorder();
+}
+
+AdaptiveFilterState AdaptiveFilter::BeginFilter() const {
 	AdaptiveFilterState state;
-	state.start_time = high_resolution_clock::now();
+	state.measure = observe && CanPermute();
 	return state;
 }
 
-void AdaptiveFilter::EndFilter(AdaptiveFilterState state) {
-	if (permutation.size() <= 1 || disable_permutations) {
-		// nothing to permute
+void AdaptiveFilter::EndPredicate(AdaptiveFilterState &state, idx_t predicate_idx, idx_t input_count,
+                                  idx_t output_count) {
+	if (!state.measure) {
 		return;
 	}
 	auto end_time = high_resolution_clock::now();
-	AdaptRuntimeStatistics(duration_cast<duration<double>>(end_time - state.start_time).count());
+	auto &predicate = predicates[predicate_idx];
+	predicate.window_runtime += duration_cast<duration<double>>(end_time - state.start_time).count();
+	predicate.window_input += input_count;
+	predicate.window_output += output_count;
 }
 
-void AdaptiveFilter::AdaptRuntimeStatistics(double duration) {
+void AdaptiveFilter::EndFilter(AdaptiveFilterState state) {
+	if (!CanPermute()) {
+		// nothing to permute
+		return;
+	}
 	iteration_count++;
-	runtime_sum += duration;
-
-	D_ASSERT(!disable_permutations);
-	if (!warmup) {
-		// the last swap was observed
-		if (observe && iteration_count == observe_interval) {
-			// keep swap if runtime decreased, else reverse swap
-			if (prev_mean - (runtime_sum / static_cast<double>(iteration_count)) <= 0) {
-				// reverse swap because runtime didn't decrease
-				std::swap(permutation[swap_idx], permutation[swap_idx + 1]);
-
-				// decrease swap likeliness, but make sure there is always a small likeliness left
-				if (swap_likeliness[swap_idx] > 1) {
-					swap_likeliness[swap_idx] /= 2;
-				}
-			} else {
-				// keep swap because runtime decreased, reset likeliness
-				swap_likeliness[swap_idx] = 100;
-			}
-			observe = false;
-
-			// reset values
-			iteration_count = 0;
-			runtime_sum = 0.0;
-		} else if (!observe && iteration_count == execute_interval) {
-			// save old mean to evaluate swap
-			prev_mean = runtime_sum / static_cast<double>(iteration_count);
-
-			// get swap index and swap likeliness
-			// a <= i <= b
-			auto random_number = generator.NextRandomInteger(1, NumericCast<uint32_t>(right_random_border));
+	if (observe) {
+		if (iteration_count < observe_interval) {
+			return;
+		}
+		// the sampling window is complete: update the estimates and re-rank the predicates
+		UpdateStatistics();
+		auto previous = permutation;
+		Reorder();
+		if (permutation != previous) {
+			execute_interval = ADAPTIVE_FILTER_MIN_EXECUTE_INTERVAL;
+		} else {
+			// the order is stable: sample less often
+			execute_interval = MinValue<idx_t>(execute_interval * 2, ADAPTIVE_FILTER_MAX_EXECUTE_INTERVAL);
+		}
+		observe = false;
+	} else if (iteration_count >= execute_interval) {
+		observe = true;
+	} else {
+		return;
+	}
+	iteration_count = 0;
+}
 
-			swap_idx = random_number / 100;                    // index to be swapped
-			idx_t likeliness = random_number - 100 * swap_idx; // random number between [0, 100)
+void AdaptiveFilter::UpdateStatistics() {
+	for (auto &predicate : predicates) {
+		if (predicate.window_input == 0) {
+			// the predicate was not reached (or skipped) in this window - keep the previous estimates
+			predicate.window_runtime = 0;
+			continue;
+		}
+		auto input = static_cast<double>(predicate.window_input);
+		auto cost = predicate.window_runtime / input;
+		auto selectivity = static_cast<double>(predicate.window_output) / input;
+		if (predicate.measured) {
+			// smooth the estimates over the windows
+			predicate.cost = (predicate.cost + cost) / 2;
+			predicate.selectivity = (predicate.selectivity + selectivity) / 2;
+		} else {
+			predicate.seed_cost = predicate.cost;
+			predicate.cost = cost;
+			predicate.selectivity = selectivity;
+			predicate.measured = true;
+		}
+		predicate.window_runtime = 0;
+		predicate.window_input = 0;
+		predicate.window_output = 0;
+	}
+}
 
-			// check if swap is going to happen
-			if (swap_likeliness[swap_idx] > likeliness) { // always true for the first swap of an index
-				// swap
-				std::swap(permutation[swap_idx], permutation[swap_idx + 1]);
+double AdaptiveFilter::GetRank(const PredicateStatistics &predicate, double cost) const {
+	// the fraction of tuples that no longer have to be evaluated by the subsequent predicates
+	auto decided = is_or ? predicate.selectivity : 1 - predicate.selectivity;
+	return cost / MaxValue<double>(decided, 1e-6);
+}
 
-				// observe whether swap will be applied
-				observe = true;
-			}
+double AdaptiveFilter::GetExpectedCost(const vector<idx_t> &order, const vector<double> &costs) const {
+	double result = 0;
+	double remaining = 1;
+	for (auto &idx : order) {
+		result += remaining * costs[idx];
+		remaining *= is_or ? 1 - predicates[idx].selectivity : predicates[idx].selectivity;
+	}
+	return result;
+}
 
-			// reset values
-			iteration_count = 0;
-			runtime_sum = 0.0;
-		}
-	} else {
-		if (iteration_count == 5) {
-			// initially set all values
-			iteration_count = 0;
-			runtime_sum = 0.0;
-			observe = false;
-			warmup = false;
+void AdaptiveFilter::Reorder() {
+	if (!CanPermute()) {
+		return;
+	}
+	// the seeded costs are in arbitrary units: scale them to the measured costs (if any)
+	double measured_cost = 0, measured_seed_cost = 0;
+	for (auto &predicate : predicates) {
+		if (predicate.measured) {
+			measured_cost += predicate.cost;
+			measured_seed_cost += predicate.seed_cost;
 		}
 	}
+	double scale = measured_seed_cost > 0 ? measured_cost / measured_seed_cost : 1;
+	vector<double> costs;
+	vector<double> ranks;
+	for (auto &predicate : predicates) {
+		costs.push_back(predicate.measured ? predicate.cost : predicate.cost * scale);
+		ranks.push_back(GetRank(predicate, costs.back()));
+	}
+	auto new_permutation = permutation;
+	std::stable_sort(new_permutation.begin(), new_permutation.end(),
+	                 [&](idx_t a, idx_t b) { return ranks[a] < ranks[b]; });
+	auto current_cost = GetExpectedCost(permutation, costs);
+	if (GetExpectedCost(new_permutation, costs) < current_cost * ADAPTIVE_FILTER_REORDER_THRESHOLD) {
+		permutation = std::move(new_permutation);
+	}
 }
 
 } // namespace duckdb
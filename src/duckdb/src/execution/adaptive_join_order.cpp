@@ -0,0 +1,277 @@
+#include "duckdb/execution/adaptive_join_order.hpp"
+
+#include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/main/query_profiler.hpp"
+#include "duckdb/parallel/pipeline.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+
+namespace duckdb {
+
+//! A column of the chunks in a chain of joins: a column of the input of the chain (0, col_idx), or a build-side column
+//! of the join at index join_idx of the chain (join_idx + 1, col_idx)
+using ChainColumn = pair<idx_t, idx_t>;
+
+struct ChainJoin {
+	ChainJoin(PhysicalHashJoin &op, const PhysicalHashJoin::ProbeEstimate &estimate) : op(op), estimate(estimate) {
+	}
+
+	PhysicalHashJoin &op;
+	PhysicalHashJoin::ProbeEstimate estimate;
+	//! The layout of the input chunks of the join in the plan
+	vector<ChainColumn> input_layout;
+	//! The columns that are referenced by the join conditions
+	vector<ChainColumn> condition_columns;
+	//! The joins of the chain that produce columns that are referenced by the join conditions
+	vector<idx_t> dependencies;
+};
+
+static idx_t FindColumn(const vector<ChainColumn> &layout, const ChainColumn &column) {
+	for (idx_t col_idx = 0; col_idx < layout.size(); col_idx++) {
+		if (layout[col_idx] == column) {
+			return col_idx;
+		}
+	}
+	return DConstants::INVALID_INDEX;
+}
+
+static void GetReferencedColumns(const Expression &expr, const vector<ChainColumn> &layout,
+                                 vector<ChainColumn> &result) {
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_REF) {
+		auto &column = layout[expr.Cast<BoundReferenceExpression>().index];
+		if (FindColumn(result, column) == DConstants::INVALID_INDEX) {
+			result.push_back(column);
+		}
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(
+	    expr, [&](const Expression &child) { GetReferencedColumns(child, layout, result); });
+}
+
+//! Copy an expression on the input chunks of a join, and make it reference the same columns in another layout
+static unique_ptr<Expression> RebindExpression(const Expression &expr, const vector<ChainColumn> &input_layout,
+                                               const vector<ChainColumn> &layout) {
+	auto result = expr.Copy();
+	ExpressionIterator::EnumerateExpression(result, [&](Expression &child) {
+		if (child.GetExpressionClass() == ExpressionClass::BOUND_REF) {
+			auto &ref = child.Cast<BoundReferenceExpression>();
+			ref.index = FindColumn(layout, input_layout[ref.index]);
+			D_ASSERT(ref.index != DConstants::INVALID_INDEX);
+		}
+	});
+	return result;
+}
+
+//! The expected cost of probing an input tuple of the chain with the joins in the given order
+static double GetExpectedCost(const vector<ChainJoin> &joins, const vector<idx_t> &order) {
+	double cost = 0;
+	double tuples = 1;
+	for (auto &join_idx : order) {
+		auto &estimate = joins[join_idx].estimate;
+		cost += tuples * estimate.cost;
+		tuples *= estimate.selectivity;
+	}
+	return cost;
+}
+
+//! Order the joins by their rank, i.e., by the fraction of the tuples that they remove per unit of cost. A join
+//! that references columns of the build side of another join is placed after that join.
+static vector<idx_t> OrderJoins(const vector<ChainJoin> &joins) {
+	vector<idx_t> order;
+	vector<bool> placed(joins.size(), false);
+	while (order.size() < joins.size()) {
+		auto best_idx = DConstants::INVALID_INDEX;
+		double best_rank = 0;
+		for (idx_t join_idx = 0; join_idx < joins.size(); join_idx++) {
+			if (placed[join_idx]) {
+				continue;
+			}
+			auto &join = joins[join_idx];
+			bool can_place = true;
+			for (auto &dependency : join.dependencies) {
+				if (!placed[dependency]) {
+					can_place = false;
+					break;
+				}
+			}
+			if (!can_place) {
+				continue;
+			}
+			auto rank = (join.estimate.selectivity - 1) / join.estimate.cost;
+			if (best_idx == DConstants::INVALID_INDEX || rank < best_rank) {
+				best_idx = join_idx;
+				best_rank = rank;
+			}
+		}
+		D_ASSERT(best_idx != DConstants::INVALID_INDEX);
+		placed[best_idx] = true;
+		order.push_back(best_idx);
+	}
+	return order;
+}
+
+//! Re-order a chain of joins. Returns the operators that replace the chain, or nothing if the chain is kept.
+static vector<unique_ptr<PhysicalOperator>> ReorderChain(vector<ChainJoin> &joins) {
+	vector<unique_ptr<PhysicalOperator>> result;
+	double misestimate = 1;
+	for (auto &join : joins) {
+		misestimate = MaxValue(misestimate, join.estimate.misestimate);
+	}
+	if (misestimate < AdaptiveJoinOrder::MISESTIMATE_THRESHOLD) {
+		// the join order was based on accurate estimates
+		return result;
+	}
+
+	auto &input_types = joins[0].op.children[0]->GetTypes();
+	auto get_type = [&](const ChainColumn &column) -> const LogicalType & {
+		if (column.first == 0) {
+			return input_types[column.second];
+		}
+		return joins[column.first - 1].op.rhs_output_columns.col_types[column.second];
+	};
+	vector<ChainColumn> input_layout;
+	for (idx_t col_idx = 0; col_idx < input_types.size(); col_idx++) {
+		input_layout.emplace_back(0, col_idx);
+	}
+
+	// follow the columns through the chain of joins in the plan
+	auto layout = input_layout;
+	for (idx_t join_idx = 0; join_idx < joins.size(); join_idx++) {
+		auto &join = joins[join_idx];
+		join.input_layout = layout;
+		for (auto &cond : join.op.conditions) {
+			GetReferencedColumns(*cond.left, layout, join.condition_columns);
+		}
+		for (auto &column : join.condition_columns) {
+			if (column.first != 0 && std::find(join.dependencies.begin(), join.dependencies.end(), column.first - 1) ==
+			                             join.dependencies.end()) {
+				join.dependencies.push_back(column.first - 1);
+			}
+		}
+		vector<ChainColumn> join_layout;
+		for (auto &col_idx : join.op.lhs_output_columns.col_idxs) {
+			join_layout.push_back(layout[col_idx]);
+		}
+		for (idx_t col_idx = 0; col_idx < join.op.rhs_output_columns.col_types.size(); col_idx++) {
+			join_layout.emplace_back(join_idx + 1, col_idx);
+		}
+		layout = std::move(join_layout);
+	}
+	auto output_layout = std::move(layout);
+
+	vector<idx_t> plan_order;
+	for (idx_t join_idx = 0; join_idx < joins.size(); join_idx++) {
+		plan_order.push_back(join_idx);
+	}
+	auto order = OrderJoins(joins);
+	if (order == plan_order || GetExpectedCost(joins, order) >
+	                               GetExpectedCost(joins, plan_order) * (1 - AdaptiveJoinOrder::MINIMUM_IMPROVEMENT)) {
+		return result;
+	}
+
+	// create copies of the joins in the new order: every join outputs the columns that are required after it
+	layout = input_layout;
+	for (idx_t order_idx = 0; order_idx < order.size(); order_idx++) {
+		auto &join = joins[order[order_idx]];
+		auto required_columns = output_layout;
+		for (idx_t next_idx = order_idx + 1; next_idx < order.size(); next_idx++) {
+			for (auto &column : joins[order[next_idx]].condition_columns) {
+				if (FindColumn(required_columns, column) == DConstants::INVALID_INDEX) {
+					required_columns.push_back(column);
+				}
+			}
+		}
+		PhysicalHashJoin::JoinProjectionColumns lhs_output_columns;
+		vector<ChainColumn> join_layout;
+		for (idx_t col_idx = 0; col_idx < layout.size(); col_idx++) {
+			if (FindColumn(required_columns, layout[col_idx]) == DConstants::INVALID_INDEX &&
+			    !(col_idx + 1 == layout.size() && join_layout.empty())) {
+				// the column is not required (but the join keeps at least one column of its input)
+				continue;
+			}
+			lhs_output_columns.col_idxs.push_back(col_idx);
+			lhs_output_columns.col_types.push_back(get_type(layout[col_idx]));
+			join_layout.push_back(layout[col_idx]);
+		}
+		auto types = lhs_output_columns.col_types;
+		for (idx_t col_idx = 0; col_idx < join.op.rhs_output_columns.col_types.size(); col_idx++) {
+			join_layout.emplace_back(order[order_idx] + 1, col_idx);
+			types.push_back(join.op.rhs_output_columns.col_types[col_idx]);
+		}
+
+		vector<JoinCondition> conditions;
+		for (auto &cond : join.op.conditions) {
+			JoinCondition condition;
+			condition.left = RebindExpression(*cond.left, join.input_layout, layout);
+			condition.right = cond.right->Copy();
+			condition.comparison = cond.comparison;
+			conditions.push_back(std::move(condition));
+		}
+		result.push_back(make_uniq<PhysicalHashJoin>(join.op, std::move(types), std::move(conditions),
+		                                             std::move(lhs_output_columns)));
+		layout = std::move(join_layout);
+	}
+
+	if (layout != output_layout) {
+		// restore the layout of the output of the chain in the plan
+		auto &types = joins.back().op.GetTypes();
+		vector<unique_ptr<Expression>> select_list;
+		for (idx_t col_idx = 0; col_idx < output_layout.size(); col_idx++) {
+			auto index = FindColumn(layout, output_layout[col_idx]);
+			D_ASSERT(index != DConstants::INVALID_INDEX);
+			select_list.push_back(make_uniq<BoundReferenceExpression>(types[col_idx], index));
+		}
+		result.push_back(
+		    make_uniq<PhysicalProjection>(types, std::move(select_list), joins.back().op.estimated_cardinality));
+	}
+	return result;
+}
+
+void AdaptiveJoinOrder::ReorderProbes(Pipeline &pipeline) {
+	auto &context = pipeline.GetClientContext();
+	if (!ClientConfig::GetConfig(context).enable_adaptive_join_order) {
+		return;
+	}
+	auto &profiler = QueryProfiler::Get(context);
+	vector<reference<PhysicalOperator>> operators;
+	vector<ChainJoin> chain;
+	auto finish_chain = [&]() {
+		vector<unique_ptr<PhysicalOperator>> chain_operators;
+		if (chain.size() > 1) {
+			chain_operators = ReorderChain(chain);
+		}
+		if (chain_operators.empty()) {
+			for (auto &join : chain) {
+				operators.push_back(join.op);
+			}
+		}
+		for (auto &op : chain_operators) {
+			if (op->type == PhysicalOperatorType::HASH_JOIN) {
+				profiler.AddOperatorCopy(*op, *op->Cast<PhysicalHashJoin>().build_join);
+			}
+			operators.push_back(*op);
+			pipeline.owned_operators.push_back(std::move(op));
+		}
+		chain.clear();
+	};
+
+	for (auto &op_ref : pipeline.operators) {
+		auto &op = op_ref.get();
+		if (op.type == PhysicalOperatorType::HASH_JOIN) {
+			auto &join = op.Cast<PhysicalHashJoin>();
+			PhysicalHashJoin::ProbeEstimate estimate;
+			if (join.EstimateProbe(estimate)) {
+				chain.emplace_back(join, estimate);
+				continue;
+			}
+		}
+		finish_chain();
+		operators.push_back(op);
+	}
+	finish_chain();
+	pipeline.operators = std::move(operators);
+}
+
+} // namespace duckdb
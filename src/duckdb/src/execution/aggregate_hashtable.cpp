@@ -41,7 +41,9 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
                                                      vector<AggregateObject> aggregate_objects_p,
                                                      idx_t initial_capacity, idx_t radix_bits)
     : BaseAggregateHashTable(context, allocator, aggregate_objects_p, std::move(payload_types_p)),
-      radix_bits(radix_bits), count(0), capacity(0), aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
+      radix_bits(radix_bits), count(0), skip_lookups(false), track_hot_groups(false), has_hot_groups(false),
+      capacity(0),
+      aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
 
 	// Append hash column to the end and initialise the row layout
 	group_types_p.emplace_back(LogicalType::HASH);
@@ -73,6 +75,7 @@ void GroupedAggregateHashTable::InitializePartitionedData() {
 	D_ASSERT(GetLayout().GetRowWidth() == layout.GetRowWidth());
 
 	partitioned_data->InitializeAppendState(state.append_state, TupleDataPinProperties::KEEP_EVERYTHING_PINNED);
+	ClearHotGroups();
 }
 
 unique_ptr<PartitionedTupleData> &GroupedAggregateHashTable::GetPartitionedData() {
@@ -167,6 +170,32 @@ void GroupedAggregateHashTable::ResetCount() {
 	count = 0;
 }
 
+bool GroupedAggregateHashTable::SkipLookups() const {
+	return skip_lookups;
+}
+
+void GroupedAggregateHashTable::SetSkipLookups(bool skip_lookups_p) {
+	skip_lookups = skip_lookups_p;
+}
+
+void GroupedAggregateHashTable::TrackHotGroups(bool track) {
+	if (track) {
+		if (!hot_groups) {
+			hot_groups = make_unsafe_uniq_array_uninitialized<ht_entry_t>(HOT_GROUP_CAPACITY);
+			has_hot_groups = true;
+		}
+		ClearHotGroups();
+	}
+	track_hot_groups = track;
+}
+
+void GroupedAggregateHashTable::ClearHotGroups() {
+	if (has_hot_groups) {
+		std::fill_n(hot_groups.get(), HOT_GROUP_CAPACITY, ht_entry_t::GetEmptyEntry());
+		has_hot_groups = false;
+	}
+}
+
 void GroupedAggregateHashTable::SetRadixBits(idx_t radix_bits_p) {
 	radix_bits = radix_bits_p;
 }
@@ -319,7 +348,7 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	D_ASSERT(state.hash_salts.GetType() == LogicalType::HASH);
 
 	// Need to fit the entire vector, and resize at threshold
-	if (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold()) {
+	if (!skip_lookups && (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold())) {
 		Verify();
 		Resize(capacity * 2);
 	}
@@ -331,17 +360,6 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	addresses_v.Flatten(groups.size());
 	auto addresses = FlatVector::GetData<data_ptr_t>(addresses_v);
 
-	// Compute the entry in the table based on the hash using a modulo,
-	// and precompute the hash salts for faster comparison below
-	auto ht_offsets = FlatVector::GetData<uint64_t>(state.ht_offsets);
-	const auto hash_salts = FlatVector::GetData<hash_t>(state.hash_salts);
-	for (idx_t r = 0; r < groups.size(); r++) {
-		const auto &hash = hashes[r];
-		ht_offsets[r] = ApplyBitMask(hash);
-		D_ASSERT(ht_offsets[r] == hash % capacity);
-		hash_salts[r] = ht_entry_t::ExtractSalt(hash);
-	}
-
 	// we start out with all entries [0, 1, 2, ..., groups.size()]
 	const SelectionVector *sel_vector = FlatVector::IncrementalSelectionVector();
 
@@ -364,6 +382,21 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	}
 	TupleDataCollection::GetVectorData(chunk_state, state.group_data.get());
 
+	if (skip_lookups) {
+		return AppendSkippingLookups(groups, hashes, addresses_v, new_groups_out);
+	}
+
+	// Compute the entry in the table based on the hash using a modulo,
+	// and precompute the hash salts for faster comparison below
+	auto ht_offsets = FlatVector::GetData<uint64_t>(state.ht_offsets);
+	const auto hash_salts = FlatVector::GetData<hash_t>(state.hash_salts);
+	for (idx_t r = 0; r < groups.size(); r++) {
+		const auto &hash = hashes[r];
+		ht_offsets[r] = ApplyBitMask(hash);
+		D_ASSERT(ht_offsets[r] == hash % capacity);
+		hash_salts[r] = ht_entry_t::ExtractSalt(hash);
+	}
+
 	idx_t new_group_count = 0;
 	idx_t remaining_entries = groups.size();
 	idx_t iteration_count;
@@ -433,8 +466,18 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 			}
 
 			// Perform group comparisons
-			row_matcher.Match(state.group_chunk, chunk_state.vector_data, state.group_compare_vector,
-			                  need_compare_count, layout, addresses_v, &state.no_match_vector, no_match_count);
+			const auto match_count =
+			    row_matcher.Match(state.group_chunk, chunk_state.vector_data, state.group_compare_vector,
+			                      need_compare_count, layout, addresses_v, &state.no_match_vector, no_match_count);
+			if (track_hot_groups && match_count != 0) {
+				// These groups were seen before: remember them in case we start skipping lookups
+				for (idx_t match_idx = 0; match_idx < match_count; match_idx++) {
+					const auto index = state.group_compare_vector.get_index(match_idx);
+					hot_groups[hashes[index] & (HOT_GROUP_CAPACITY - 1)] =
+					    ht_entry_t::GetDesiredEntry(addresses[index], hash_salts[index]);
+				}
+				has_hot_groups = true;
+			}
 		}
 
 		// Linear probing: each of the entries that do not match move to the next entry in the HT
@@ -454,6 +497,60 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	return new_group_count;
 }
 
+idx_t GroupedAggregateHashTable::AppendSkippingLookups(DataChunk &groups, const hash_t *hashes, Vector &addresses_v,
+                                                      SelectionVector &new_groups_out) {
+	auto addresses = FlatVector::GetData<data_ptr_t>(addresses_v);
+	auto &chunk_state = state.append_state.chunk_state;
+
+	// Rows of a hot group are aggregated into the existing group, we only probe a single (cache-resident) entry
+	idx_t new_entry_count = 0;
+	const SelectionVector *append_sel = FlatVector::IncrementalSelectionVector();
+	if (has_hot_groups) {
+		idx_t need_compare_count = 0;
+		for (idx_t i = 0; i < groups.size(); i++) {
+			const auto &entry = hot_groups[hashes[i] & (HOT_GROUP_CAPACITY - 1)];
+			if (entry.IsOccupied() && entry.GetSalt() == ht_entry_t::ExtractSalt(hashes[i])) {
+				addresses[i] = entry.GetPointer();
+				state.group_compare_vector.set_index(need_compare_count++, i);
+			} else {
+				state.empty_vector.set_index(new_entry_count++, i);
+			}
+		}
+		if (need_compare_count != 0) {
+			idx_t no_match_count = 0;
+			row_matcher.Match(state.group_chunk, chunk_state.vector_data, state.group_compare_vector,
+			                  need_compare_count, layout, addresses_v, &state.no_match_vector, no_match_count);
+			for (idx_t i = 0; i < no_match_count; i++) {
+				state.empty_vector.set_index(new_entry_count++, state.no_match_vector.get_index(i));
+			}
+		}
+		append_sel = &state.empty_vector;
+	} else {
+		new_entry_count = groups.size();
+	}
+	if (new_entry_count == 0) {
+		return 0;
+	}
+
+	// Every other row becomes a new group without touching the pointer table, duplicates are combined later
+	if (new_entry_count == groups.size()) {
+		partitioned_data->AppendUnified(state.append_state, state.group_chunk);
+	} else {
+		partitioned_data->AppendUnified(state.append_state, state.group_chunk, *append_sel, new_entry_count);
+	}
+	RowOperations::InitializeStates(layout, chunk_state.row_locations, *FlatVector::IncrementalSelectionVector(),
+	                                new_entry_count);
+
+	const auto row_locations = FlatVector::GetData<data_ptr_t>(chunk_state.row_locations);
+	const auto &row_sel = state.append_state.reverse_partition_sel;
+	for (idx_t i = 0; i < new_entry_count; i++) {
+		const auto index = append_sel->get_index(i);
+		addresses[index] = row_locations[row_sel.get_index(index)];
+		new_groups_out.set_index(i, index);
+	}
+	return new_entry_count;
+}
+
 // this is to support distinct aggregations where we need to record whether we
 // have already seen a value for a group
 idx_t GroupedAggregateHashTable::FindOrCreateGroups(DataChunk &groups, Vector &group_hashes, Vector &addresses_out,
@@ -553,6 +650,7 @@ void GroupedAggregateHashTable::Combine(TupleDataCollection &other_data, optiona
 }
 
 void GroupedAggregateHashTable::UnpinData() {
+	ClearHotGroups();
 	partitioned_data->FlushAppendState(state.append_state);
 	partitioned_data->Unpin();
 }
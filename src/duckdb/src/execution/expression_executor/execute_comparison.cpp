@@ -11,6 +11,10 @@ namespace duckdb {
 
 unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundComparisonExpression &expr,
                                                                 ExpressionExecutorState &root) {
+	auto fused = InitializeFusedState(expr, root);
+	if (fused) {
+		return fused;
+	}
 	auto result = make_uniq<ExpressionState>(expr, root);
 	result->AddChild(*expr.left);
 	result->AddChild(*expr.right);
@@ -21,6 +25,10 @@ unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundCompa
 
 void ExpressionExecutor::Execute(const BoundComparisonExpression &expr, ExpressionState *state,
                                  const SelectionVector *sel, idx_t count, Vector &result) {
+	if (state->fused) {
+		ExecuteFused(state, sel, count, result);
+		return;
+	}
 	// resolve the children
 	state->intermediate_chunk.Reset();
 	auto &left = state->intermediate_chunk.data[0];
@@ -349,6 +357,9 @@ idx_t VectorOperations::LessThanEquals(Vector &left, Vector &right, optional_ptr
 idx_t ExpressionExecutor::Select(const BoundComparisonExpression &expr, ExpressionState *state,
                                  const SelectionVector *sel, idx_t count, SelectionVector *true_sel,
                                  SelectionVector *false_sel) {
+	if (state->fused) {
+		return SelectFused(state, sel, count, true_sel, false_sel);
+	}
 	// resolve the children
 	state->intermediate_chunk.Reset();
 	auto &left = state->intermediate_chunk.data[0];
@@ -74,9 +74,11 @@ idx_t ExpressionExecutor::Select(const BoundConjunctionExpression &expr, Express
 			true_sel = temp_true.get();
 		}
 		for (idx_t i = 0; i < expr.children.size(); i++) {
-			idx_t tcount = Select(*expr.children[state.adaptive_filter->permutation[i]],
-			                      state.child_states[state.adaptive_filter->permutation[i]].get(), current_sel,
+			auto child_idx = state.adaptive_filter->permutation[i];
+			state.adaptive_filter->BeginPredicate(filter_state);
+			idx_t tcount = Select(*expr.children[child_idx], state.child_states[child_idx].get(), current_sel,
 			                      current_count, true_sel, temp_false.get());
+			state.adaptive_filter->EndPredicate(filter_state, child_idx, current_count, tcount);
 			idx_t fcount = current_count - tcount;
 			if (fcount > 0 && false_sel) {
 				// move failing tuples into the false_sel
@@ -115,9 +117,11 @@ idx_t ExpressionExecutor::Select(const BoundConjunctionExpression &expr, Express
 			false_sel = temp_false.get();
 		}
 		for (idx_t i = 0; i < expr.children.size(); i++) {
-			idx_t tcount = Select(*expr.children[state.adaptive_filter->permutation[i]],
-			                      state.child_states[state.adaptive_filter->permutation[i]].get(), current_sel,
+			auto child_idx = state.adaptive_filter->permutation[i];
+			state.adaptive_filter->BeginPredicate(filter_state);
+			idx_t tcount = Select(*expr.children[child_idx], state.child_states[child_idx].get(), current_sel,
 			                      current_count, temp_true.get(), false_sel);
+			state.adaptive_filter->EndPredicate(filter_state, child_idx, current_count, tcount);
 			if (tcount > 0) {
 				if (true_sel) {
 					// tuples passed, move them into the actual result vector
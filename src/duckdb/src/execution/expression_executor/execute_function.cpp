@@ -12,6 +12,10 @@ ExecuteFunctionState::~ExecuteFunctionState() {
 
 unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundFunctionExpression &expr,
                                                                 ExpressionExecutorState &root) {
+	auto fused = InitializeFusedState(expr, root);
+	if (fused) {
+		return fused;
+	}
 	auto result = make_uniq<ExecuteFunctionState>(expr, root);
 	for (auto &child : expr.children) {
 		result->AddChild(*child);
@@ -59,6 +63,10 @@ static void VerifyNullHandling(const BoundFunctionExpression &expr, DataChunk &a
 
 void ExpressionExecutor::Execute(const BoundFunctionExpression &expr, ExpressionState *state,
                                  const SelectionVector *sel, idx_t count, Vector &result) {
+	if (state->fused) {
+		ExecuteFused(state, sel, count, result);
+		return;
+	}
 	state->intermediate_chunk.Reset();
 	auto &arguments = state->intermediate_chunk;
 	if (!state->types.empty()) {
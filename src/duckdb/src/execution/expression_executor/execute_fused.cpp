@@ -0,0 +1,404 @@
+#include "duckdb/common/operator/add.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/operator/multiply.hpp"
+#include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/common/vector_operations/ternary_executor.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+
+namespace duckdb {
+
+#ifndef DUCKDB_SMALLER_BINARY
+// The arithmetic operators as bound for INTEGER/BIGINT (with overflow check) and DOUBLE
+struct FusedAddOperator {
+	template <class T>
+	static inline T Operation(T left, T right) {
+		return AddOperatorOverflowCheck::Operation<T, T, T>(left, right);
+	}
+};
+
+template <>
+inline double FusedAddOperator::Operation(double left, double right) {
+	return AddOperator::Operation<double, double, double>(left, right);
+}
+
+struct FusedSubtractOperator {
+	template <class T>
+	static inline T Operation(T left, T right) {
+		return SubtractOperatorOverflowCheck::Operation<T, T, T>(left, right);
+	}
+};
+
+template <>
+inline double FusedSubtractOperator::Operation(double left, double right) {
+	return SubtractOperator::Operation<double, double, double>(left, right);
+}
+
+struct FusedMultiplyOperator {
+	template <class T>
+	static inline T Operation(T left, T right) {
+		return MultiplyOperatorOverflowCheck::Operation<T, T, T>(left, right);
+	}
+};
+
+template <>
+inline double FusedMultiplyOperator::Operation(double left, double right) {
+	return MultiplyOperator::Operation<double, double, double>(left, right);
+}
+
+//! (a OP b) OUTER_OP c, or a OUTER_OP (b OP c)
+template <class OP, class OUTER_OP, bool NESTED_LEFT>
+struct FusedArithmeticOperator {
+	template <class A_TYPE, class B_TYPE, class C_TYPE, class RESULT_TYPE>
+	static inline RESULT_TYPE Operation(A_TYPE a, B_TYPE b, C_TYPE c) {
+		return NESTED_LEFT ? OUTER_OP::Operation(OP::Operation(a, b), c) : OUTER_OP::Operation(a, OP::Operation(b, c));
+	}
+};
+
+//! (a OP b) COMPARISON c
+template <class OP, class COMPARISON>
+struct FusedComparisonOperator {
+	template <class T>
+	static inline bool Operation(T a, T b, T c) {
+		return COMPARISON::Operation(OP::Operation(a, b), c);
+	}
+
+	template <class A_TYPE, class B_TYPE, class C_TYPE, class RESULT_TYPE>
+	static inline RESULT_TYPE Operation(A_TYPE a, B_TYPE b, C_TYPE c) {
+		return Operation<A_TYPE>(a, b, c);
+	}
+};
+
+template <class T, class OP>
+static void FusedExecute(Vector &a, Vector &b, Vector &c, Vector &result, idx_t count) {
+	TernaryExecutor::ExecuteStandard<T, T, T, T, OP>(a, b, c, result, count);
+}
+
+template <class T, class OP>
+static void FusedComparisonExecute(Vector &a, Vector &b, Vector &c, Vector &result, idx_t count) {
+	TernaryExecutor::ExecuteStandard<T, T, T, bool, OP>(a, b, c, result, count);
+}
+
+template <class T, class OP>
+static idx_t FusedComparisonSelect(Vector &a, Vector &b, Vector &c, const SelectionVector *sel, idx_t count,
+                                   SelectionVector *true_sel, SelectionVector *false_sel) {
+	return TernaryExecutor::Select<T, T, T, OP>(a, b, c, sel, count, true_sel, false_sel);
+}
+
+//! The fused kernels skip rows in which any input is NULL - but the nested expression is evaluated on its own when
+//! only the outer operand is NULL, and raises an error if it overflows. This evaluates it for those rows.
+template <class T, class OP, bool NESTED_LEFT>
+static void FusedCheck(Vector &a, Vector &b, Vector &c, idx_t count) {
+	auto &outer = NESTED_LEFT ? c : a;
+	UnifiedVectorFormat outer_data;
+	outer.ToUnifiedFormat(count, outer_data);
+	if (outer_data.validity.AllValid()) {
+		return;
+	}
+	UnifiedVectorFormat ldata, rdata;
+	(NESTED_LEFT ? a : b).ToUnifiedFormat(count, ldata);
+	(NESTED_LEFT ? b : c).ToUnifiedFormat(count, rdata);
+	auto lvalues = UnifiedVectorFormat::GetData<T>(ldata);
+	auto rvalues = UnifiedVectorFormat::GetData<T>(rdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto outer_idx = outer_data.sel->get_index(i);
+		auto lidx = ldata.sel->get_index(i);
+		auto ridx = rdata.sel->get_index(i);
+		if (!outer_data.validity.RowIsValid(outer_idx) && ldata.validity.RowIsValid(lidx) &&
+		    rdata.validity.RowIsValid(ridx)) {
+			OP::Operation(lvalues[lidx], rvalues[ridx]);
+		}
+	}
+}
+
+enum class FusedArithmeticType : uint8_t { ADD, SUBTRACT, MULTIPLY };
+
+static bool IsFusedType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! Whether the expression is a binary +, - or * on (and returning) the given type
+static bool IsFusedArithmetic(const Expression &expr, const LogicalType &type, FusedArithmeticType &result) {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_FUNCTION || expr.return_type != type) {
+		return false;
+	}
+	auto &function = expr.Cast<BoundFunctionExpression>();
+	if (function.children.size() != 2 || function.children[0]->return_type != type ||
+	    function.children[1]->return_type != type) {
+		return false;
+	}
+	auto &name = function.function.name;
+	if (name == "+") {
+		result = FusedArithmeticType::ADD;
+	} else if (name == "-") {
+		result = FusedArithmeticType::SUBTRACT;
+	} else if (name == "*") {
+		result = FusedArithmeticType::MULTIPLY;
+	} else {
+		return false;
+	}
+	return true;
+}
+
+template <class T, class OP, class OUTER_OP>
+static fused_execute_t GetFusedArithmetic(bool nested_left) {
+	if (nested_left) {
+		return FusedExecute<T, FusedArithmeticOperator<OP, OUTER_OP, true>>;
+	}
+	return FusedExecute<T, FusedArithmeticOperator<OP, OUTER_OP, false>>;
+}
+
+template <class T, class OP>
+static fused_execute_t GetFusedArithmetic(FusedArithmeticType outer_op, bool nested_left) {
+	switch (outer_op) {
+	case FusedArithmeticType::ADD:
+		return GetFusedArithmetic<T, OP, FusedAddOperator>(nested_left);
+	case FusedArithmeticType::SUBTRACT:
+		return GetFusedArithmetic<T, OP, FusedSubtractOperator>(nested_left);
+	case FusedArithmeticType::MULTIPLY:
+		return GetFusedArithmetic<T, OP, FusedMultiplyOperator>(nested_left);
+	default:
+		throw InternalException("Unsupported fused arithmetic");
+	}
+}
+
+template <class T>
+static fused_execute_t GetFusedArithmetic(FusedArithmeticType op, FusedArithmeticType outer_op, bool nested_left) {
+	switch (op) {
+	case FusedArithmeticType::ADD:
+		return GetFusedArithmetic<T, FusedAddOperator>(outer_op, nested_left);
+	case FusedArithmeticType::SUBTRACT:
+		return GetFusedArithmetic<T, FusedSubtractOperator>(outer_op, nested_left);
+	case FusedArithmeticType::MULTIPLY:
+		return GetFusedArithmetic<T, FusedMultiplyOperator>(outer_op, nested_left);
+	default:
+		throw InternalException("Unsupported fused arithmetic");
+	}
+}
+
+template <class T, class OP>
+static fused_check_t GetFusedCheck(bool nested_left) {
+	if (nested_left) {
+		return FusedCheck<T, OP, true>;
+	}
+	return FusedCheck<T, OP, false>;
+}
+
+template <class T>
+static fused_check_t GetFusedCheck(FusedArithmeticType op, bool nested_left) {
+	switch (op) {
+	case FusedArithmeticType::ADD:
+		return GetFusedCheck<T, FusedAddOperator>(nested_left);
+	case FusedArithmeticType::SUBTRACT:
+		return GetFusedCheck<T, FusedSubtractOperator>(nested_left);
+	case FusedArithmeticType::MULTIPLY:
+		return GetFusedCheck<T, FusedMultiplyOperator>(nested_left);
+	default:
+		throw InternalException("Unsupported fused arithmetic");
+	}
+}
+
+template <class T, class OP, class COMPARISON>
+static void SetFusedComparison(FusedExpressionState &state) {
+	state.execute = FusedComparisonExecute<T, FusedComparisonOperator<OP, COMPARISON>>;
+	state.select = FusedComparisonSelect<T, FusedComparisonOperator<OP, COMPARISON>>;
+}
+
+template <class T, class OP>
+static void SetFusedComparison(FusedExpressionState &state, ExpressionType comparison) {
+	switch (comparison) {
+	case ExpressionType::COMPARE_EQUAL:
+		return SetFusedComparison<T, OP, Equals>(state);
+	case ExpressionType::COMPARE_NOTEQUAL:
+		return SetFusedComparison<T, OP, NotEquals>(state);
+	case ExpressionType::COMPARE_LESSTHAN:
+		return SetFusedComparison<T, OP, LessThan>(state);
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return SetFusedComparison<T, OP, GreaterThan>(state);
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return SetFusedComparison<T, OP, LessThanEquals>(state);
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return SetFusedComparison<T, OP, GreaterThanEquals>(state);
+	default:
+		throw InternalException("Unsupported fused comparison");
+	}
+}
+
+template <class T>
+static void SetFusedComparison(FusedExpressionState &state, FusedArithmeticType op, ExpressionType comparison) {
+	switch (op) {
+	case FusedArithmeticType::ADD:
+		return SetFusedComparison<T, FusedAddOperator>(state, comparison);
+	case FusedArithmeticType::SUBTRACT:
+		return SetFusedComparison<T, FusedSubtractOperator>(state, comparison);
+	case FusedArithmeticType::MULTIPLY:
+		return SetFusedComparison<T, FusedMultiplyOperator>(state, comparison);
+	default:
+		throw InternalException("Unsupported fused arithmetic");
+	}
+}
+
+unique_ptr<ExpressionState> ExpressionExecutor::InitializeFusedState(const BoundFunctionExpression &expr,
+                                                                     ExpressionExecutorState &root) {
+	auto &type = expr.return_type;
+	FusedArithmeticType outer_op, op;
+	if (!IsFusedType(type) || !IsFusedArithmetic(expr, type, outer_op)) {
+		return nullptr;
+	}
+	bool nested_left;
+	if (IsFusedArithmetic(*expr.children[0], type, op)) {
+		nested_left = true;
+	} else if (IsFusedArithmetic(*expr.children[1], type, op)) {
+		nested_left = false;
+	} else {
+		return nullptr;
+	}
+
+	auto result = make_uniq<FusedExpressionState>(expr, root);
+	if (nested_left) {
+		auto &child = expr.children[0]->Cast<BoundFunctionExpression>();
+		result->AddChild(*child.children[0]);
+		result->AddChild(*child.children[1]);
+		result->AddChild(*expr.children[1]);
+	} else {
+		auto &child = expr.children[1]->Cast<BoundFunctionExpression>();
+		result->AddChild(*expr.children[0]);
+		result->AddChild(*child.children[0]);
+		result->AddChild(*child.children[1]);
+	}
+	result->Finalize();
+
+	switch (type.InternalType()) {
+	case PhysicalType::INT32:
+		result->execute = GetFusedArithmetic<int32_t>(op, outer_op, nested_left);
+		result->check = GetFusedCheck<int32_t>(op, nested_left);
+		break;
+	case PhysicalType::INT64:
+		result->execute = GetFusedArithmetic<int64_t>(op, outer_op, nested_left);
+		result->check = GetFusedCheck<int64_t>(op, nested_left);
+		break;
+	case PhysicalType::DOUBLE:
+		result->execute = GetFusedArithmetic<double>(op, outer_op, nested_left);
+		break;
+	default:
+		throw InternalException("Unsupported type for fused arithmetic");
+	}
+	return std::move(result);
+}
+
+unique_ptr<ExpressionState> ExpressionExecutor::InitializeFusedState(const BoundComparisonExpression &expr,
+                                                                     ExpressionExecutorState &root) {
+	auto &type = expr.left->return_type;
+	if (!IsFusedType(type) || expr.right->return_type != type) {
+		return nullptr;
+	}
+	switch (expr.type) {
+	case ExpressionType::COMPARE_EQUAL:
+	case ExpressionType::COMPARE_NOTEQUAL:
+	case ExpressionType::COMPARE_LESSTHAN:
+	case ExpressionType::COMPARE_GREATERTHAN:
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		break;
+	default:
+		return nullptr;
+	}
+	// the arithmetic goes on the left: "a < b + c" is evaluated as "b + c > a"
+	FusedArithmeticType op;
+	auto comparison = expr.type;
+	optional_ptr<const BoundFunctionExpression> arithmetic;
+	optional_ptr<Expression> other;
+	if (IsFusedArithmetic(*expr.left, type, op)) {
+		arithmetic = expr.left->Cast<BoundFunctionExpression>();
+		other = expr.right.get();
+	} else if (IsFusedArithmetic(*expr.right, type, op)) {
+		arithmetic = expr.right->Cast<BoundFunctionExpression>();
+		other = expr.left.get();
+		comparison = FlipComparisonExpression(comparison);
+	} else {
+		return nullptr;
+	}
+
+	auto result = make_uniq<FusedExpressionState>(expr, root);
+	result->AddChild(*arithmetic->children[0]);
+	result->AddChild(*arithmetic->children[1]);
+	result->AddChild(*other);
+	result->Finalize();
+
+	switch (type.InternalType()) {
+	case PhysicalType::INT32:
+		SetFusedComparison<int32_t>(*result, op, comparison);
+		result->check = GetFusedCheck<int32_t>(op, true);
+		break;
+	case PhysicalType::INT64:
+		SetFusedComparison<int64_t>(*result, op, comparison);
+		result->check = GetFusedCheck<int64_t>(op, true);
+		break;
+	case PhysicalType::DOUBLE:
+		SetFusedComparison<double>(*result, op, comparison);
+		break;
+	default:
+		throw InternalException("Unsupported type for fused comparison");
+	}
+	return std::move(result);
+}
+
+void ExpressionExecutor::ExecuteFused(ExpressionState *state, const SelectionVector *sel, idx_t count,
+                                      Vector &result) {
+	auto &fused_state = state->Cast<FusedExpressionState>();
+	state->intermediate_chunk.Reset();
+	auto &inputs = state->intermediate_chunk.data;
+	for (idx_t i = 0; i < 3; i++) {
+		Execute(state->child_states[i]->expr, state->child_states[i].get(), sel, count, inputs[i]);
+	}
+	if (fused_state.check) {
+		fused_state.check(inputs[0], inputs[1], inputs[2], count);
+	}
+	fused_state.execute(inputs[0], inputs[1], inputs[2], result, count);
+}
+
+idx_t ExpressionExecutor::SelectFused(ExpressionState *state, const SelectionVector *sel, idx_t count,
+                                      SelectionVector *true_sel, SelectionVector *false_sel) {
+	auto &fused_state = state->Cast<FusedExpressionState>();
+	D_ASSERT(fused_state.select);
+	state->intermediate_chunk.Reset();
+	auto &inputs = state->intermediate_chunk.data;
+	for (idx_t i = 0; i < 3; i++) {
+		Execute(state->child_states[i]->expr, state->child_states[i].get(), sel, count, inputs[i]);
+	}
+	if (fused_state.check) {
+		fused_state.check(inputs[0], inputs[1], inputs[2], count);
+	}
+	return fused_state.select(inputs[0], inputs[1], inputs[2], sel, count, true_sel, false_sel);
+}
+#else
+unique_ptr<ExpressionState> ExpressionExecutor::InitializeFusedState(const BoundFunctionExpression &expr,
+                                                                     ExpressionExecutorState &root) {
+	return nullptr;
+}
+
+unique_ptr<ExpressionState> ExpressionExecutor::InitializeFusedState(const BoundComparisonExpression &expr,
+                                                                     ExpressionExecutorState &root) {
+	return nullptr;
+}
+
+void ExpressionExecutor::ExecuteFused(ExpressionState *state, const SelectionVector *sel, idx_t count,
+                                      Vector &result) {
+	throw InternalException("Fused expressions are not supported in this build");
+}
+
+idx_t ExpressionExecutor::SelectFused(ExpressionState *state, const SelectionVector *sel, idx_t count,
+                                      SelectionVector *true_sel, SelectionVector *false_sel) {
+	throw InternalException("Fused expressions are not supported in this build");
+}
+#endif
+
+} // namespace duckdb
@@ -42,6 +42,11 @@ ClientContext &ExpressionState::GetContext() {
 ExpressionState::ExpressionState(const Expression &expr, ExpressionExecutorState &root) : expr(expr), root(root) {
 }
 
+FusedExpressionState::FusedExpressionState(const Expression &expr, ExpressionExecutorState &root)
+    : ExpressionState(expr, root) {
+	fused = true;
+}
+
 ExpressionExecutorState::ExpressionExecutorState() {
 }
 
@@ -895,6 +895,30 @@ bool ART::SearchCloseRange(ARTKey &lower_bound, ARTKey &upper_bound, bool left_e
 	return it.Scan(upper_bound, max_count, row_ids, right_equal);
 }
 
+bool ART::ScanOrdered(const idx_t max_count, unsafe_vector<row_t> &row_ids) {
+	lock_guard<mutex> l(lock);
+	if (!tree.HasMetadata()) {
+		return true;
+	}
+
+	// Start at the minimum value and scan without an upper bound.
+	Iterator it(*this);
+	it.FindMinimum(tree);
+	return it.Scan(ARTKey(), max_count, row_ids, false);
+}
+
+void ART::LookupRowIds(unsafe_vector<ARTKey> &keys, const idx_t count, vector<unsafe_vector<row_t>> &row_ids) {
+	D_ASSERT(keys.size() >= count && row_ids.size() >= count);
+	lock_guard<mutex> l(lock);
+	for (idx_t i = 0; i < count; i++) {
+		row_ids[i].clear();
+		if (keys[i].Empty() || !tree.HasMetadata()) {
+			continue;
+		}
+		SearchEqual(keys[i], NumericLimits<idx_t>::Maximum(), row_ids[i]);
+	}
+}
+
 bool ART::Scan(IndexScanState &state, const idx_t max_count, unsafe_vector<row_t> &row_ids) {
 	auto &scan_state = state.Cast<ARTIndexScanState>();
 	D_ASSERT(scan_state.values[0].type().InternalType() == types[0]);
@@ -132,6 +132,13 @@ void JoinHashTable::Merge(JoinHashTable &other) {
 	sink_collection->Combine(*other.sink_collection);
 }
 
+//! Hint the CPU to load the cache line of a pointer, so that the cache misses of a vector of probes overlap
+static inline void Prefetch(const void *pointer) {
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(pointer);
+#endif
+}
+
 static void ApplyBitmaskAndGetSaltBuild(Vector &hashes_v, const idx_t &count, const idx_t &bitmask) {
 	if (hashes_v.GetVectorType() == VectorType::CONSTANT_VECTOR) {
 		D_ASSERT(!ConstantVector::IsNull(hashes_v));
@@ -168,14 +175,19 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 	auto ht_offsets_dense = FlatVector::GetData<idx_t>(state.ht_offsets_dense_v);
 
 	idx_t non_empty_count = 0;
+	const bool prefetch = ht->UsePrefetch();
 
 	// first, filter out the empty rows and calculate the offset
+	// for large tables, we prefetch the entries so that the loads of the next loop hit the cache
 	for (idx_t i = 0; i < count; i++) {
 		const auto row_index = sel.get_index(i);
 		auto uvf_index = hashes_v_unified.sel->get_index(row_index);
 		auto ht_offset = hashes[uvf_index] & ht->bitmask;
 		ht_offsets_dense[i] = ht_offset;
 		ht_offsets[row_index] = ht_offset;
+		if (prefetch) {
+			Prefetch(entries + ht_offset);
+		}
 	}
 
 	// have a dense loop to have as few instructions as possible while producing cache misses as this is the
@@ -254,6 +266,10 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 			// entry might be empty, so the pointer in the entry is nullptr, but this does not matter as the row
 			// will not be compared anyway as with an empty entry we are already done
 			row_ptr_insert_to[row_index] = entry.GetPointerOrNull();
+			if (prefetch && occupied) {
+				// the row matcher will compare the keys of this row after the loop
+				Prefetch(row_ptr_insert_to[row_index]);
+			}
 		}
 
 		if (salt_match_count != 0) {
@@ -293,6 +309,10 @@ inline bool JoinHashTable::UseSalt() const {
 	return this->capacity > USE_SALT_THRESHOLD && this->equality_predicate_columns.size() == 1;
 }
 
+bool JoinHashTable::UsePrefetch() const {
+	return this->capacity > USE_PREFETCH_THRESHOLD;
+}
+
 void JoinHashTable::GetRowPointers(DataChunk &keys, TupleDataChunkState &key_state, ProbeState &state, Vector &hashes_v,
                                    const SelectionVector &sel, idx_t &count, Vector &pointers_result_v,
                                    SelectionVector &match_sel) {
@@ -879,6 +899,12 @@ void ScanStructure::AdvancePointers(const SelectionVector &sel, const idx_t sel_
 			this->sel_vector.set_index(new_count++, idx);
 		}
 	}
+	if (ht.UsePrefetch()) {
+		// the next rows of the chains are compared and gathered after this, load them all at once
+		for (idx_t i = 0; i < new_count; i++) {
+			Prefetch(ptrs[this->sel_vector.get_index(i)]);
+		}
+	}
 	this->count = new_count;
 }
 
@@ -1382,6 +1408,10 @@ idx_t JoinHashTable::GetRemainingSize() const {
 		count += partitions[partition_idx]->Count();
 		data_size += partitions[partition_idx]->SizeInBytes();
 	}
+	for (auto &piece : partition_pieces) {
+		count += piece->Count();
+		data_size += piece->SizeInBytes();
+	}
 
 	return data_size + PointerTableSize(count);
 }
@@ -1410,8 +1440,13 @@ void JoinHashTable::SetRepartitionRadixBits(const idx_t max_ht_size, const idx_t
 		}
 	}
 	radix_bits += added_bits;
-	sink_collection =
+	auto new_sink_collection =
 	    make_uniq<RadixPartitionedTupleData>(buffer_manager, layout, radix_bits, layout.ColumnCount() - 1);
+	if (sink_collection->Count() != 0) {
+		// the largest partition still did not fit after a previous repartitioning: repartition again
+		sink_collection->Repartition(*new_sink_collection);
+	}
+	sink_collection = std::move(new_sink_collection);
 }
 
 void JoinHashTable::Repartition(JoinHashTable &global_ht) {
@@ -1433,6 +1468,13 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 		Reset();
 	}
 
+	if (!partition_pieces.empty()) {
+		// Build the next piece of the partition that did not fit, the probe side is probed again
+		data_collection->Combine(*partition_pieces.back());
+		partition_pieces.pop_back();
+		return true;
+	}
+
 	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
 	if (partition_end == num_partitions) {
 		return false;
@@ -1450,7 +1492,8 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 		auto incl_count = count + partitions[partition_idx]->Count();
 		auto incl_data_size = data_size + partitions[partition_idx]->SizeInBytes();
 		auto incl_ht_size = incl_data_size + PointerTableSize(incl_count);
-		if (count > 0 && incl_ht_size > max_ht_size) {
+		if (partition_idx > partition_start && incl_ht_size > max_ht_size) {
+			// A partition that does not fit is always done on its own, even if the preceding ones are empty
 			break;
 		}
 		count = incl_count;
@@ -1458,6 +1501,16 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 	}
 	partition_end = partition_idx;
 
+	if (count != 0 && data_size + PointerTableSize(count) > max_ht_size && CanSplitPartitions()) {
+		// A single partition does not fit, and no more radix bits can split it (e.g., it consists of one key)
+		D_ASSERT(partition_end == partition_start + 1);
+		SplitPartition(*partitions[partition_start], max_ht_size);
+		D_ASSERT(!partition_pieces.empty());
+		data_collection->Combine(*partition_pieces.back());
+		partition_pieces.pop_back();
+		return true;
+	}
+
 	// Move the partitions to the main data collection
 	for (partition_idx = partition_start; partition_idx < partition_end; partition_idx++) {
 		data_collection->Combine(*partitions[partition_idx]);
@@ -1467,6 +1520,48 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 	return true;
 }
 
+bool JoinHashTable::CanSplitPartitions() const {
+	switch (join_type) {
+	case JoinType::INNER:
+	case JoinType::RIGHT:
+	case JoinType::RIGHT_SEMI:
+	case JoinType::RIGHT_ANTI:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void JoinHashTable::SplitPartition(TupleDataCollection &partition, const idx_t max_ht_size) {
+	D_ASSERT(partition_pieces.empty());
+	// Copy the partition into new collections, releasing the blocks of the partition as we go
+	TupleDataScanState scan_state;
+	partition.InitializeScan(scan_state, TupleDataPinProperties::DESTROY_AFTER_DONE);
+	DataChunk chunk;
+	partition.InitializeScanChunk(scan_state, chunk);
+
+	TupleDataAppendState append_state;
+	while (partition.Scan(scan_state, chunk)) {
+		if (partition_pieces.empty() ||
+		    partition_pieces.back()->SizeInBytes() + PointerTableSize(partition_pieces.back()->Count() + chunk.size()) >
+		        max_ht_size) {
+			if (!partition_pieces.empty()) {
+				partition_pieces.back()->FinalizePinState(append_state.pin_state);
+			}
+			partition_pieces.push_back(make_uniq<TupleDataCollection>(buffer_manager, layout));
+			partition_pieces.back()->InitializeAppend(append_state);
+		}
+		partition_pieces.back()->Append(append_state, chunk);
+	}
+	if (!partition_pieces.empty()) {
+		partition_pieces.back()->FinalizePinState(append_state.pin_state);
+	}
+	partition.Reset();
+
+	// The pieces are taken from the back
+	std::reverse(partition_pieces.begin(), partition_pieces.end());
+}
+
 static void CreateSpillChunk(DataChunk &spill_chunk, DataChunk &payload, Vector &hashes) {
 	D_ASSERT(spill_chunk.ColumnCount() == payload.ColumnCount() + 1);
 	spill_chunk.Reset();
@@ -1493,10 +1588,16 @@ void JoinHashTable::ProbeAndSpill(ScanStructure &scan_structure, DataChunk &keys
 
 	CreateSpillChunk(spill_chunk, payload, hashes);
 
-	// can't probe these values right now, append to spill
-	spill_chunk.Slice(false_sel, false_count);
-	spill_chunk.Verify();
-	probe_spill.Append(spill_chunk, spill_state);
+	if (HasRemainingPartitionPieces()) {
+		// the current partition was split, the values we probe now must also be probed against the other pieces
+		spill_chunk.Verify();
+		probe_spill.Append(spill_chunk, spill_state);
+	} else {
+		// can't probe these values right now, append to spill
+		spill_chunk.Slice(false_sel, false_count);
+		spill_chunk.Verify();
+		probe_spill.Append(spill_chunk, spill_state);
+	}
 
 	// slice the stuff we CAN probe right now
 	hashes.Slice(true_sel, true_count);
@@ -1554,7 +1655,9 @@ void ProbeSpill::Finalize() {
 
 void ProbeSpill::PrepareNextProbe() {
 	auto &partitions = global_partitions->GetPartitions();
-	if (partitions.empty() || ht.partition_start == partitions.size()) {
+	if (probe_again) {
+		// The build side of this round is the next piece of the previous partition: keep the probe data
+	} else if (partitions.empty() || ht.partition_start == partitions.size()) {
 		// Can't probe, just make an empty one
 		global_spill_collection =
 		    make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), probe_types);
@@ -1570,7 +1673,8 @@ void ProbeSpill::PrepareNextProbe() {
 			}
 		}
 	}
-	consumer = make_uniq<ColumnDataConsumer>(*global_spill_collection, column_ids);
+	probe_again = ht.HasRemainingPartitionPieces();
+	consumer = make_uniq<ColumnDataConsumer>(*global_spill_collection, column_ids, !probe_again);
 	consumer->InitializeScan();
 }
 
@@ -0,0 +1,356 @@
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
+
+#include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/execution/operator/aggregate/aggregate_object.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+PhysicalStreamingAggregate::PhysicalStreamingAggregate(vector<LogicalType> types,
+                                                       vector<unique_ptr<Expression>> aggregates,
+                                                       vector<unique_ptr<Expression>> groups,
+                                                       idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::STREAMING_AGGREGATE, std::move(types), estimated_cardinality) {
+	grouped_aggregate_data.InitializeGroupby(std::move(groups), std::move(aggregates), {});
+
+	// the payload holds the aggregate children followed by the filters
+	// rebind the filters to their position in the payload
+	idx_t payload_idx = 0;
+	for (auto &aggr : grouped_aggregate_data.bindings) {
+		D_ASSERT(!aggr->IsDistinct());
+		payload_idx += aggr->children.size();
+	}
+	for (auto &aggr : grouped_aggregate_data.bindings) {
+		if (aggr->filter) {
+			auto &bound_ref_expr = aggr->filter->Cast<BoundReferenceExpression>();
+			filter_indexes.push_back(bound_ref_expr.index);
+			bound_ref_expr.index = payload_idx++;
+		}
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// State
+//===--------------------------------------------------------------------===//
+class StreamingAggregateState : public OperatorState {
+public:
+	//! Once the arena grows beyond this, the state of the current group is moved to a fresh arena
+	static constexpr const idx_t MINIMUM_ARENA_SIZE = 1048576;
+
+	StreamingAggregateState(ExecutionContext &context, const PhysicalStreamingAggregate &op)
+	    : aggregates(AggregateObject::CreateAggregateObjects(op.grouped_aggregate_data.bindings)),
+	      allocator(make_uniq<ArenaAllocator>(BufferAllocator::Get(context.client))),
+	      spare_allocator(make_uniq<ArenaAllocator>(BufferAllocator::Get(context.client))),
+	      arena_limit(MINIMUM_ARENA_SIZE), addresses(LogicalType::POINTER), aggregate_addresses(LogicalType::POINTER),
+	      candidates(STANDARD_VECTOR_SIZE), equal_sel(STANDARD_VECTOR_SIZE), distinct_sel(STANDARD_VECTOR_SIZE),
+	      lhs_sel(STANDARD_VECTOR_SIZE), rhs_sel(STANDARD_VECTOR_SIZE), group_starts(STANDARD_VECTOR_SIZE) {
+		state_size = 0;
+		for (auto &aggr : aggregates) {
+			offsets.push_back(state_size);
+			state_size += aggr.payload_size;
+		}
+		// every row of an input chunk can start a new group, plus the group carried over from the previous chunk
+		states = make_unsafe_uniq_array_uninitialized<data_t>(MaxValue<idx_t>(state_size, 1) *
+		                                                      (STANDARD_VECTOR_SIZE + 1));
+
+		auto &payload_types = op.grouped_aggregate_data.payload_types;
+		if (!payload_types.empty()) {
+			payload.InitializeEmpty(payload_types);
+		}
+		filter_set.Initialize(context.client, aggregates, payload_types);
+		group_values.resize(op.grouped_aggregate_data.GroupCount());
+	}
+
+	~StreamingAggregateState() override {
+		if (has_group) {
+			Destroy(0, 1);
+		}
+	}
+
+	//! The aggregates
+	vector<AggregateObject> aggregates;
+	//! The offset of each aggregate within the state of a group
+	vector<idx_t> offsets;
+	idx_t state_size;
+	//! The states of the groups of the current chunk, the first one belongs to the group that is still open
+	unsafe_unique_array<data_t> states;
+	//! The arena the aggregates allocate from, and the one the open group is moved to when it grows too large
+	unique_ptr<ArenaAllocator> allocator;
+	unique_ptr<ArenaAllocator> spare_allocator;
+	idx_t arena_limit;
+
+	//! Whether there is an open group, and its group values
+	bool has_group = false;
+	vector<Value> group_values;
+
+	//! The aggregate inputs
+	DataChunk payload;
+	AggregateFilterDataSet filter_set;
+	//! The state of every input row
+	Vector addresses;
+	Vector aggregate_addresses;
+
+	//! Whether each row starts a new group
+	bool new_group[STANDARD_VECTOR_SIZE];
+	SelectionVector candidates;
+	SelectionVector equal_sel;
+	SelectionVector distinct_sel;
+	SelectionVector lhs_sel;
+	SelectionVector rhs_sel;
+	//! The first row of every group that starts in the current chunk
+	SelectionVector group_starts;
+
+public:
+	data_ptr_t GetState(idx_t slot) {
+		return states.get() + slot * state_size;
+	}
+
+	void Initialize(idx_t slot) {
+		auto state = GetState(slot);
+		for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+			auto &aggr = aggregates[aggr_idx];
+			aggr.function.initialize(aggr.function, state + offsets[aggr_idx]);
+		}
+	}
+
+	//! Point aggregate_addresses at the states of an aggregate for the groups [begin, begin + count)
+	void SetAddresses(idx_t aggr_idx, idx_t begin, idx_t count) {
+		auto pointers = FlatVector::GetData<data_ptr_t>(aggregate_addresses);
+		for (idx_t i = 0; i < count; i++) {
+			pointers[i] = GetState(begin + i) + offsets[aggr_idx];
+		}
+	}
+
+	void Update(idx_t count) {
+		RowOperationsState row_state(*allocator);
+		auto row_addresses = FlatVector::GetData<data_ptr_t>(addresses);
+		auto pointers = FlatVector::GetData<data_ptr_t>(aggregate_addresses);
+		idx_t payload_idx = 0;
+		for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+			auto &aggr = aggregates[aggr_idx];
+			for (idx_t i = 0; i < count; i++) {
+				pointers[i] = row_addresses[i] + offsets[aggr_idx];
+			}
+			if (aggr.filter) {
+				RowOperations::UpdateFilteredStates(row_state, filter_set.GetFilterData(aggr_idx), aggr,
+				                                    aggregate_addresses, payload, payload_idx);
+			} else {
+				RowOperations::UpdateStates(row_state, aggr, aggregate_addresses, payload, payload_idx, count);
+			}
+			payload_idx += aggr.child_count;
+		}
+	}
+
+	//! Finalize the groups [begin, begin + count) into the aggregate columns of the result
+	void Finalize(idx_t begin, idx_t count, DataChunk &result, idx_t aggr_column) {
+		for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+			auto &aggr = aggregates[aggr_idx];
+			SetAddresses(aggr_idx, begin, count);
+			AggregateInputData aggr_input_data(aggr.GetFunctionData(), *allocator);
+			aggr.function.finalize(aggregate_addresses, aggr_input_data, result.data[aggr_column + aggr_idx], count,
+			                       0);
+		}
+		Destroy(begin, count);
+	}
+
+	void Destroy(idx_t begin, idx_t count) {
+		for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+			auto &aggr = aggregates[aggr_idx];
+			if (aggr.function.destructor) {
+				SetAddresses(aggr_idx, begin, count);
+				AggregateInputData aggr_input_data(aggr.GetFunctionData(), *allocator);
+				aggr.function.destructor(aggregate_addresses, aggr_input_data, count);
+			}
+		}
+	}
+
+	//! Finished groups never free their arena memory, so once the arena has grown large enough we copy the open group
+	//! into a fresh arena and release everything else
+	void ShrinkArena() {
+		if (allocator->SizeInBytes() <= arena_limit) {
+			return;
+		}
+		Initialize(1);
+		Vector source(LogicalType::POINTER);
+		Vector target(LogicalType::POINTER);
+		for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+			auto &aggr = aggregates[aggr_idx];
+			FlatVector::GetData<data_ptr_t>(source)[0] = GetState(0) + offsets[aggr_idx];
+			FlatVector::GetData<data_ptr_t>(target)[0] = GetState(1) + offsets[aggr_idx];
+			AggregateInputData aggr_input_data(aggr.GetFunctionData(), *spare_allocator);
+			aggr.function.combine(source, target, aggr_input_data, 1);
+		}
+		Destroy(0, 1);
+		memcpy(GetState(0), GetState(1), state_size);
+		allocator->Reset();
+		std::swap(allocator, spare_allocator);
+		arena_limit = MaxValue<idx_t>(MINIMUM_ARENA_SIZE, 2 * allocator->SizeInBytes());
+	}
+};
+
+unique_ptr<OperatorState> PhysicalStreamingAggregate::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<StreamingAggregateState>(context, *this);
+}
+
+//===--------------------------------------------------------------------===//
+// Execute
+//===--------------------------------------------------------------------===//
+OperatorResultType PhysicalStreamingAggregate::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                       GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	auto &groups = grouped_aggregate_data.groups;
+	const auto count = input.size();
+	if (count == 0) {
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	// find the rows that start a new group by comparing every row with the previous one
+	// the group columns are compared one by one, only for the rows that were equal so far
+	memset(state.new_group, 0, sizeof(bool) * count);
+	idx_t candidate_count = count - 1;
+	for (idx_t i = 0; i < candidate_count; i++) {
+		state.candidates.set_index(i, i + 1);
+		state.lhs_sel.set_index(i + 1, i);
+		state.rhs_sel.set_index(i + 1, i + 1);
+	}
+	state.lhs_sel.set_index(0, 0);
+	state.rhs_sel.set_index(0, 0);
+	for (idx_t group_idx = 0; group_idx < groups.size() && candidate_count > 0; group_idx++) {
+		auto &column = input.data[groups[group_idx]->Cast<BoundReferenceExpression>().index];
+		Vector lhs(column, state.lhs_sel, count);
+		Vector rhs(column, state.rhs_sel, count);
+		auto equal_count = VectorOperations::NotDistinctFrom(lhs, rhs, &state.candidates, candidate_count,
+		                                                     &state.equal_sel, &state.distinct_sel);
+		for (idx_t i = 0; i < candidate_count - equal_count; i++) {
+			state.new_group[state.distinct_sel.get_index(i)] = true;
+		}
+		std::swap(state.candidates, state.equal_sel);
+		candidate_count = equal_count;
+	}
+
+	// the first row either continues the open group or closes it
+	bool close_open_group = false;
+	if (state.has_group) {
+		for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+			auto column_idx = groups[group_idx]->Cast<BoundReferenceExpression>().index;
+			if (!Value::NotDistinctFrom(state.group_values[group_idx], input.GetValue(column_idx, 0))) {
+				close_open_group = true;
+				break;
+			}
+		}
+	}
+
+	// assign every row to the state of its group
+	idx_t slot = 0;
+	idx_t start_count = 0;
+	if (!state.has_group) {
+		state.Initialize(slot);
+		state.group_starts.set_index(start_count++, 0);
+	} else if (close_open_group) {
+		state.Initialize(++slot);
+		state.group_starts.set_index(start_count++, 0);
+	}
+	auto row_addresses = FlatVector::GetData<data_ptr_t>(state.addresses);
+	for (idx_t i = 0; i < count; i++) {
+		if (state.new_group[i]) {
+			state.Initialize(++slot);
+			state.group_starts.set_index(start_count++, i);
+		}
+		row_addresses[i] = state.GetState(slot);
+	}
+
+	// update the aggregates
+	idx_t payload_idx = 0;
+	for (auto &aggr : grouped_aggregate_data.bindings) {
+		for (auto &child_expr : aggr->children) {
+			D_ASSERT(child_expr->type == ExpressionType::BOUND_REF);
+			auto &bound_ref_expr = child_expr->Cast<BoundReferenceExpression>();
+			state.payload.data[payload_idx++].Reference(input.data[bound_ref_expr.index]);
+		}
+	}
+	for (auto &filter_idx : filter_indexes) {
+		state.payload.data[payload_idx++].Reference(input.data[filter_idx]);
+	}
+	state.payload.SetCardinality(count);
+	state.Update(count);
+
+	// emit every group but the last one, which might continue in the next chunk
+	idx_t result_idx = 0;
+	if (close_open_group) {
+		for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+			chunk.data[group_idx].SetValue(0, state.group_values[group_idx]);
+		}
+		result_idx++;
+	}
+	if (start_count > 0) {
+		auto last_start = state.group_starts.get_index(start_count - 1);
+		for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+			auto column_idx = groups[group_idx]->Cast<BoundReferenceExpression>().index;
+			VectorOperations::Copy(input.data[column_idx], chunk.data[group_idx], state.group_starts,
+			                       start_count - 1, 0, result_idx);
+			state.group_values[group_idx] = input.GetValue(column_idx, last_start);
+		}
+	}
+	if (slot > 0) {
+		state.Finalize(0, slot, chunk, groups.size());
+		chunk.SetCardinality(slot);
+		// the last group becomes the open group
+		memcpy(state.GetState(0), state.GetState(slot), state.state_size);
+	}
+	state.has_group = true;
+	state.ShrinkArena();
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorFinalizeResultType PhysicalStreamingAggregate::FinalExecute(ExecutionContext &context, DataChunk &chunk,
+                                                                    GlobalOperatorState &gstate,
+                                                                    OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	if (!state.has_group) {
+		return OperatorFinalizeResultType::FINISHED;
+	}
+	auto &groups = grouped_aggregate_data.groups;
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		chunk.data[group_idx].SetValue(0, state.group_values[group_idx]);
+	}
+	state.Finalize(0, 1, chunk, groups.size());
+	chunk.SetCardinality(1);
+	state.has_group = false;
+	return OperatorFinalizeResultType::FINISHED;
+}
+
+//===--------------------------------------------------------------------===//
+// ParamsToString
+//===--------------------------------------------------------------------===//
+InsertionOrderPreservingMap<string> PhysicalStreamingAggregate::ParamsToString() const {
+	InsertionOrderPreservingMap<string> result;
+	auto &groups = grouped_aggregate_data.groups;
+	auto &aggregates = grouped_aggregate_data.aggregates;
+	string groups_info;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			groups_info += "\n";
+		}
+		groups_info += groups[i]->GetName();
+	}
+	result["Groups"] = groups_info;
+	string aggregate_info;
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		auto &aggregate = aggregates[i]->Cast<BoundAggregateExpression>();
+		if (i > 0) {
+			aggregate_info += "\n";
+		}
+		aggregate_info += aggregates[i]->GetName();
+		if (aggregate.filter) {
+			aggregate_info += " Filter: " + aggregate.filter->GetName();
+		}
+	}
+	result["Aggregates"] = aggregate_info;
+	SetEstimatedCardinality(result, estimated_cardinality);
+	return result;
+}
+
+} // namespace duckdb
@@ -1,5 +1,7 @@
 #include "duckdb/execution/operator/helper/physical_pragma.hpp"
 
+#include "duckdb/main/plan_cache.hpp"
+
 namespace duckdb {
 
 SourceResultType PhysicalPragma::GetData(ExecutionContext &context, DataChunk &chunk,
@@ -7,6 +9,8 @@ SourceResultType PhysicalPragma::GetData(ExecutionContext &context, DataChunk &c
 	auto &client = context.client;
 	FunctionParameters parameters {info->parameters, info->named_parameters};
 	info->function.function(client, parameters);
+	// pragmas can change settings directly, which cached plans might depend on
+	PlanCache::Get(client).SettingsChanged();
 
 	return SourceResultType::FINISHED;
 }
@@ -3,6 +3,7 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/plan_cache.hpp"
 
 namespace duckdb {
 
@@ -23,6 +24,7 @@ SourceResultType PhysicalReset::GetData(ExecutionContext &context, DataChunk &ch
 	if (scope == SetScope::VARIABLE) {
 		auto &client_config = ClientConfig::GetConfig(context.client);
 		client_config.ResetUserVariable(name);
+		PlanCache::Get(context.client).SettingsChanged();
 		return SourceResultType::FINISHED;
 	}
 	auto &config = DBConfig::GetConfig(context.client);
@@ -37,6 +39,7 @@ SourceResultType PhysicalReset::GetData(ExecutionContext &context, DataChunk &ch
 			D_ASSERT(entry != config.extension_parameters.end());
 		}
 		ResetExtensionVariable(context, config, entry->second);
+		PlanCache::Get(context.client).SettingsChanged();
 		return SourceResultType::FINISHED;
 	}
 
@@ -69,6 +72,8 @@ SourceResultType PhysicalReset::GetData(ExecutionContext &context, DataChunk &ch
 	default:
 		throw InternalException("Unsupported SetScope for variable");
 	}
+	// cached plans might depend on the old value
+	PlanCache::Get(context.client).SettingsChanged();
 
 	return SourceResultType::FINISHED;
 }
@@ -3,6 +3,7 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/plan_cache.hpp"
 
 namespace duckdb {
 
@@ -36,6 +37,7 @@ SourceResultType PhysicalSet::GetData(ExecutionContext &context, DataChunk &chun
 			D_ASSERT(entry != config.extension_parameters.end());
 		}
 		SetExtensionVariable(context.client, entry->second, name, scope, value);
+		PlanCache::Get(context.client).SettingsChanged();
 		return SourceResultType::FINISHED;
 	}
 	SetScope variable_scope = scope;
@@ -68,6 +70,8 @@ SourceResultType PhysicalSet::GetData(ExecutionContext &context, DataChunk &chun
 	default:
 		throw InternalException("Unsupported SetScope for variable");
 	}
+	// cached plans might depend on the old value
+	PlanCache::Get(context.client).SettingsChanged();
 
 	return SourceResultType::FINISHED;
 }
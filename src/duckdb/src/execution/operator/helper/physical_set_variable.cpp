@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/helper/physical_set_variable.hpp"
 #include "duckdb/main/client_config.hpp"
+#include "duckdb/main/plan_cache.hpp"
 
 namespace duckdb {
 
@@ -32,6 +33,7 @@ SinkResultType PhysicalSetVariable::Sink(ExecutionContext &context, DataChunk &c
 	}
 	auto &config = ClientConfig::GetConfig(context.client);
 	config.SetUserVariable(name, chunk.GetValue(0, 0));
+	PlanCache::Get(context.client).SettingsChanged();
 	gstate.is_set = true;
 	return SinkResultType::NEED_MORE_INPUT;
 }
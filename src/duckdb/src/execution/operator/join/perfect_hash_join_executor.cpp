@@ -160,8 +160,9 @@ public:
 	SelectionVector seq_sel_vec;
 };
 
-unique_ptr<OperatorState> PerfectHashJoinExecutor::GetOperatorState(ExecutionContext &context) {
-	auto state = make_uniq<PerfectHashJoinState>(context.client, join);
+unique_ptr<OperatorState> PerfectHashJoinExecutor::GetOperatorState(ExecutionContext &context,
+                                                                    const PhysicalHashJoin &probe_join) {
+	auto state = make_uniq<PerfectHashJoinState>(context.client, probe_join);
 	return std::move(state);
 }
 
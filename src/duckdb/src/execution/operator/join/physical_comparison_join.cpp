@@ -11,6 +11,13 @@ PhysicalComparisonJoin::PhysicalComparisonJoin(LogicalOperator &op, PhysicalOper
 	ReorderConditions(conditions);
 }
 
+PhysicalComparisonJoin::PhysicalComparisonJoin(PhysicalOperatorType type, vector<LogicalType> types,
+                                               vector<JoinCondition> conditions_p, JoinType join_type,
+                                               idx_t estimated_cardinality)
+    : PhysicalJoin(type, std::move(types), join_type, estimated_cardinality), conditions(std::move(conditions_p)) {
+	ReorderConditions(conditions);
+}
+
 InsertionOrderPreservingMap<string> PhysicalComparisonJoin::ParamsToString() const {
 	InsertionOrderPreservingMap<string> result;
 	result["Join Type"] = EnumUtil::ToString(join_type);
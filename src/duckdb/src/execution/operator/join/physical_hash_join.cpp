@@ -105,6 +105,16 @@ PhysicalHashJoin::PhysicalHashJoin(LogicalOperator &op, unique_ptr<PhysicalOpera
                        estimated_cardinality, std::move(perfect_join_state), nullptr) {
 }
 
+PhysicalHashJoin::PhysicalHashJoin(const PhysicalHashJoin &build_join_p, vector<LogicalType> types,
+                                   vector<JoinCondition> cond, JoinProjectionColumns lhs_output_columns_p)
+    : PhysicalComparisonJoin(PhysicalOperatorType::HASH_JOIN, std::move(types), std::move(cond),
+                             build_join_p.join_type, build_join_p.estimated_cardinality),
+      condition_types(build_join_p.condition_types), payload_columns(build_join_p.payload_columns),
+      lhs_output_columns(std::move(lhs_output_columns_p)), rhs_output_columns(build_join_p.rhs_output_columns),
+      delim_types(build_join_p.delim_types), perfect_join_statistics(build_join_p.perfect_join_statistics),
+      build_join(&build_join_p) {
+}
+
 //===--------------------------------------------------------------------===//
 // Sink
 //===--------------------------------------------------------------------===//
@@ -151,6 +161,16 @@ public:
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
 	void InitializeProbeSpill();
+	//! The minimum reservation for building a partition. If the hash table can build a partition in several pieces,
+	//! a (skewed) partition that is larger than a fraction of the memory limit does not have to fit entirely
+	idx_t MinimumPartitionReservation(ClientContext &context, idx_t probe_side_requirement) const {
+		auto max_partition_ht_size = max_partition_size + JoinHashTable::PointerTableSize(max_partition_count);
+		if (hash_table->CanSplitPartitions()) {
+			max_partition_ht_size =
+			    MinValue(max_partition_ht_size, BufferManager::GetBufferManager(context).GetQueryMaxMemory() / 4);
+		}
+		return max_partition_ht_size + probe_side_requirement;
+	}
 
 public:
 	ClientContext &context;
@@ -194,6 +214,12 @@ unique_ptr<JoinFilterLocalState> JoinFilterPushdownInfo::GetLocalState(JoinFilte
 	return result;
 }
 
+//! The sink state of the join that built the hash table (which is another join if this join is a copy)
+static HashJoinGlobalSinkState &GetBuildSinkState(const PhysicalHashJoin &op) {
+	auto &build_op = op.build_join ? *op.build_join : op;
+	return build_op.sink_state->Cast<HashJoinGlobalSinkState>();
+}
+
 class HashJoinLocalSinkState : public LocalSinkState {
 public:
 	HashJoinLocalSinkState(const PhysicalHashJoin &op, ClientContext &context, HashJoinGlobalSinkState &gstate)
@@ -549,22 +575,38 @@ public:
 		local_hts.clear();
 
 		// Minimum reservation is now the new smallest partition size
-		const auto num_partitions = RadixPartitioning::NumberOfPartitions(sink.hash_table->GetRadixBits());
-		vector<idx_t> partition_sizes(num_partitions, 0);
-		vector<idx_t> partition_counts(num_partitions, 0);
-		sink.total_size = sink.hash_table->GetTotalSize(partition_sizes, partition_counts, sink.max_partition_size,
-		                                                sink.max_partition_count);
+		auto &ht = *sink.hash_table;
+		auto previous_max_partition_size = sink.max_partition_size;
+		ComputePartitionSizes();
+		// Partitioning with more bits only helps if the largest partition actually shrinks (it does not with skew)
+		while (ht.GetRadixBits() < RadixPartitioning::MAX_RADIX_BITS &&
+		       sink.max_partition_size + JoinHashTable::PointerTableSize(sink.max_partition_count) >
+		           sink.temporary_memory_state->GetReservation() &&
+		       sink.max_partition_size <= previous_max_partition_size / 2) {
+			ht.SetRepartitionRadixBits(sink.temporary_memory_state->GetReservation(), sink.max_partition_size,
+			                           sink.max_partition_count);
+			previous_max_partition_size = sink.max_partition_size;
+			ComputePartitionSizes();
+		}
 		const auto probe_side_requirement =
-		    GetPartitioningSpaceRequirement(sink.context, op.types, sink.hash_table->GetRadixBits(), sink.num_threads);
+		    GetPartitioningSpaceRequirement(sink.context, op.types, ht.GetRadixBits(), sink.num_threads);
 
-		sink.temporary_memory_state->SetMinimumReservation(sink.max_partition_size +
-		                                                   JoinHashTable::PointerTableSize(sink.max_partition_count) +
-		                                                   probe_side_requirement);
+		sink.temporary_memory_state->SetMinimumReservation(
+		    sink.MinimumPartitionReservation(sink.context, probe_side_requirement));
 		sink.temporary_memory_state->UpdateReservation(executor.context);
 
 		sink.hash_table->PrepareExternalFinalize(sink.temporary_memory_state->GetReservation());
 		sink.ScheduleFinalize(*pipeline, *this);
 	}
+
+private:
+	void ComputePartitionSizes() {
+		const auto num_partitions = RadixPartitioning::NumberOfPartitions(sink.hash_table->GetRadixBits());
+		vector<idx_t> partition_sizes(num_partitions, 0);
+		vector<idx_t> partition_counts(num_partitions, 0);
+		sink.total_size = sink.hash_table->GetTotalSize(partition_sizes, partition_counts, sink.max_partition_size,
+		                                                sink.max_partition_count);
+	}
 };
 
 void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const {
@@ -635,7 +677,8 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 			// No repartitioning! We do need some space for partitioning the probe-side, though
 			const auto probe_side_requirement =
 			    GetPartitioningSpaceRequirement(context, children[0]->types, ht.GetRadixBits(), sink.num_threads);
-			sink.temporary_memory_state->SetMinimumReservation(max_partition_ht_size + probe_side_requirement);
+			sink.temporary_memory_state->SetMinimumReservation(
+			    sink.MinimumPartitionReservation(context, probe_side_requirement));
 			for (auto &local_ht : sink.local_hash_tables) {
 				ht.Merge(*local_ht);
 			}
@@ -677,6 +720,73 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	return SinkFinalizeType::READY;
 }
 
+bool PhysicalHashJoin::CanReuseHashTable() const {
+	if (!keep_hash_table || !sink_state || PropagatesBuildSide(join_type)) {
+		// joins that emit tuples of the build side keep track of the matches of their probes
+		return false;
+	}
+	auto &sink = sink_state->Cast<HashJoinGlobalSinkState>();
+	// an external join builds and probes its hash table one set of partitions at a time
+	return sink.finalized && !sink.external;
+}
+
+bool PhysicalHashJoin::EstimateProbe(ProbeEstimate &result) const {
+	if (build_join || !sink_state) {
+		return false;
+	}
+	switch (join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+	case JoinType::ANTI:
+		break;
+	default:
+		// these joins output probe tuples without a match, or emit tuples of the build side
+		return false;
+	}
+	auto &sink = sink_state->Cast<HashJoinGlobalSinkState>();
+	if (!sink.finalized || sink.external) {
+		// an external join spills its probe side, which has to keep the layout of the plan
+		return false;
+	}
+	auto &ht = *sink.hash_table;
+	auto probe_estimate = MaxValue<double>(static_cast<double>(children[0]->estimated_cardinality), 1);
+	auto build_estimate = MaxValue<double>(static_cast<double>(children[1]->estimated_cardinality), 1);
+	auto build_count = static_cast<double>(ht.Count());
+	auto build_ratio = build_count / build_estimate;
+
+	// the estimated join size grows linearly with the size of the build side
+	auto selectivity = static_cast<double>(estimated_cardinality) / probe_estimate;
+	switch (join_type) {
+	case JoinType::INNER:
+		selectivity *= build_ratio;
+		if (sink.perfect_join_executor || !ht.chains_longer_than_one) {
+			// the build keys are unique: a probe tuple matches at most one build tuple
+			selectivity = MinValue<double>(selectivity, 1);
+		}
+		break;
+	case JoinType::SEMI:
+		selectivity = MinValue<double>(selectivity * build_ratio, 1);
+		break;
+	default: {
+		auto match_fraction = MaxValue<double>(1 - selectivity, 0);
+		selectivity = 1 - MinValue<double>(match_fraction * build_ratio, 1);
+		break;
+	}
+	}
+	result.selectivity = selectivity;
+	// probing a perfect hash table is a lookup, a regular hash table has to compare the keys (and follow the chains)
+	if (sink.perfect_join_executor) {
+		result.cost = 1;
+	} else if (ht.needs_chain_matcher || ht.chains_longer_than_one) {
+		result.cost = 3;
+	} else {
+		result.cost = 2;
+	}
+	build_ratio = MaxValue<double>(build_count, 1) / build_estimate;
+	result.misestimate = build_ratio < 1 ? 1 / build_ratio : build_ratio;
+	return true;
+}
+
 //===--------------------------------------------------------------------===//
 // Operator
 //===--------------------------------------------------------------------===//
@@ -707,14 +817,14 @@ public:
 
 unique_ptr<OperatorState> PhysicalHashJoin::GetOperatorState(ExecutionContext &context) const {
 	auto &allocator = BufferAllocator::Get(context.client);
-	auto &sink = sink_state->Cast<HashJoinGlobalSinkState>();
+	auto &sink = GetBuildSinkState(*this);
 	auto state = make_uniq<HashJoinOperatorState>(context.client, sink);
 	state->lhs_join_keys.Initialize(allocator, condition_types);
 	if (!lhs_output_columns.col_types.empty()) {
 		state->lhs_output.Initialize(allocator, lhs_output_columns.col_types);
 	}
 	if (sink.perfect_join_executor) {
-		state->perfect_hash_join_state = sink.perfect_join_executor->GetOperatorState(context);
+		state->perfect_hash_join_state = sink.perfect_join_executor->GetOperatorState(context, *this);
 	} else {
 		for (auto &cond : conditions) {
 			state->probe_executor.AddExpression(*cond.left);
@@ -732,7 +842,7 @@ unique_ptr<OperatorState> PhysicalHashJoin::GetOperatorState(ExecutionContext &c
 OperatorResultType PhysicalHashJoin::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
                                                      GlobalOperatorState &gstate, OperatorState &state_p) const {
 	auto &state = state_p.Cast<HashJoinOperatorState>();
-	auto &sink = sink_state->Cast<HashJoinGlobalSinkState>();
+	auto &sink = GetBuildSinkState(*this);
 	D_ASSERT(sink.finalized);
 	D_ASSERT(!sink.scanned_data);
 
@@ -1181,6 +1291,10 @@ SourceResultType PhysicalHashJoin::GetData(ExecutionContext &context, DataChunk
 	auto &sink = sink_state->Cast<HashJoinGlobalSinkState>();
 	auto &gstate = input.global_state.Cast<HashJoinGlobalSourceState>();
 	auto &lstate = input.local_state.Cast<HashJoinLocalSourceState>();
+	if (keep_hash_table && !sink.external && !PropagatesBuildSide(join_type)) {
+		// the hash table is probed again
+		return SourceResultType::FINISHED;
+	}
 	sink.scanned_data = true;
 
 	if (!sink.external && !PropagatesBuildSide(join_type)) {
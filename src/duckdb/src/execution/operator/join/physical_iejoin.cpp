@@ -1,6 +1,7 @@
 #include "duckdb/execution/operator/join/physical_iejoin.hpp"
 
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/common/bit_utils.hpp"
 #include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/sort/sort.hpp"
@@ -11,6 +12,7 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/event.hpp"
 #include "duckdb/parallel/meta_pipeline.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
@@ -237,6 +239,10 @@ struct IEJoinUnion {
 
 	IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, SortedTable &t1, const idx_t b1, SortedTable &t2,
 	            const idx_t b2);
+	//! Join the range [begin, end) of the rows of L2 of the block pair of another joiner
+	IEJoinUnion(const PhysicalIEJoin &op, const IEJoinUnion &other, const idx_t begin, const idx_t end_p);
+
+	void InitializeRange(const PhysicalIEJoin &op, const idx_t begin, const idx_t end_p);
 
 	idx_t SearchL1(idx_t pos);
 	bool NextRow();
@@ -245,14 +251,14 @@ struct IEJoinUnion {
 	idx_t JoinComplexBlocks(SelectionVector &lsel, SelectionVector &rsel);
 
 	//! L1
-	unique_ptr<SortedTable> l1;
+	shared_ptr<SortedTable> l1;
 	//! L2
-	unique_ptr<SortedTable> l2;
+	shared_ptr<SortedTable> l2;
 
 	//! Li
-	vector<int64_t> li;
+	shared_ptr<vector<int64_t>> li;
 	//! P
-	vector<idx_t> p;
+	shared_ptr<vector<idx_t>> p;
 
 	//! B
 	vector<validity_t> bit_array;
@@ -264,8 +270,12 @@ struct IEJoinUnion {
 	vector<validity_t> bloom_array;
 	ValidityMask bloom_filter;
 
+	//! The minimum number of rows of L2 in a range that is joined by a separate thread
+	static constexpr idx_t MIN_RANGE_ROWS = 16384;
+
 	//! Iteration state
 	idx_t n;
+	idx_t end;
 	idx_t i;
 	idx_t j;
 	unique_ptr<SBIterator> op1;
@@ -347,7 +357,7 @@ idx_t IEJoinUnion::AppendKey(SortedTable &table, ExpressionExecutor &executor, S
 
 IEJoinUnion::IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, SortedTable &t1, const idx_t b1,
                          SortedTable &t2, const idx_t b2)
-    : n(0), i(0) {
+    : n(0), end(0), i(0) {
 	// input : query Q with 2 join predicates t1.X op1 t2.X' and t1.Y op2 t2.Y', tables T, T' of sizes m and n resp.
 	// output: a list of tuple pairs (ti , tj)
 	// Note that T/T' are already sorted on X/X' and contain the payload data
@@ -408,7 +418,7 @@ IEJoinUnion::IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, Sorte
 	orders.emplace_back(SBIterator::ComparisonValue(cmp1) == 0 ? OrderType::DESCENDING : OrderType::ASCENDING,
 	                    OrderByNullType::ORDER_DEFAULT, std::move(from_left));
 
-	l1 = make_uniq<SortedTable>(context, orders, payload_layout, op);
+	l1 = make_shared_ptr<SortedTable>(context, orders, payload_layout, op);
 
 	// LHS has positive rids
 	ExpressionExecutor l_executor(context);
@@ -438,7 +448,7 @@ IEJoinUnion::IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, Sorte
 	off1 = make_uniq<SBIterator>(l1->global_sort_state, cmp1);
 
 	// We don't actually need the L1 column, just its sort key, which is in the sort blocks
-	li = ExtractColumn<int64_t>(*l1, types.size() - 1);
+	li = make_shared_ptr<vector<int64_t>>(ExtractColumn<int64_t>(*l1, types.size() - 1));
 
 	// 4. if (op2 ∈ {>, ≥}) sort L2 in ascending order
 	// 5. else if (op2 ∈ {<, ≤}) sort L2 in descending order
@@ -457,7 +467,7 @@ IEJoinUnion::IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, Sorte
 	ExpressionExecutor executor(context);
 	executor.AddExpression(*orders[0].expression);
 
-	l2 = make_uniq<SortedTable>(context, orders, payload_layout, op);
+	l2 = make_shared_ptr<SortedTable>(context, orders, payload_layout, op);
 	for (idx_t base = 0, block_idx = 0; block_idx < l1->BlockCount(); ++block_idx) {
 		base += AppendKey(*l1, executor, *l2, 1, NumericCast<int64_t>(base), block_idx);
 	}
@@ -467,10 +477,19 @@ IEJoinUnion::IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, Sorte
 	// We don't actually need the L2 column, just its sort key, which is in the sort blocks
 
 	// 6. compute the permutation array P of L2 w.r.t. L1
-	p = ExtractColumn<idx_t>(*l2, types.size() - 1);
+	p = make_shared_ptr<vector<idx_t>>(ExtractColumn<idx_t>(*l2, types.size() - 1));
 
-	// 7. initialize bit-array B (|B| = n), and set all bits to 0
 	n = l2->count.load();
+	InitializeRange(op, 0, n);
+}
+
+IEJoinUnion::IEJoinUnion(const PhysicalIEJoin &op, const IEJoinUnion &other, const idx_t begin, const idx_t end_p)
+    : l1(other.l1), l2(other.l2), li(other.li), p(other.p), n(other.n) {
+	InitializeRange(op, begin, end_p);
+}
+
+void IEJoinUnion::InitializeRange(const PhysicalIEJoin &op, const idx_t begin, const idx_t end_p) {
+	// 7. initialize bit-array B (|B| = n), and set all bits to 0
 	bit_array.resize(ValidityMask::EntryCount(n), 0);
 	bit_mask.Initialize(bit_array.data(), n);
 
@@ -480,19 +499,22 @@ IEJoinUnion::IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, Sorte
 	bloom_filter.Initialize(bloom_array.data(), bloom_count);
 
 	// 11. for(i←1 to n) do
+	// off2 starts at the beginning of L2 for every range,
+	// so the first call of NextRow sets the bits of B that the rows before the range would have set
 	const auto &cmp2 = op.conditions[1].comparison;
 	op2 = make_uniq<SBIterator>(l2->global_sort_state, cmp2);
 	off2 = make_uniq<SBIterator>(l2->global_sort_state, cmp2);
-	i = 0;
+	end = end_p;
+	i = begin;
 	j = 0;
 	(void)NextRow();
 }
 
 bool IEJoinUnion::NextRow() {
-	for (; i < n; ++i) {
+	for (; i < end; ++i) {
 		// 12. pos ← P[i]
-		auto pos = p[i];
-		lrid = li[pos];
+		auto pos = (*p)[i];
+		lrid = (*li)[pos];
 		if (lrid < 0) {
 			continue;
 		}
@@ -503,8 +525,8 @@ bool IEJoinUnion::NextRow() {
 			if (!off2->Compare(*op2)) {
 				break;
 			}
-			const auto p2 = p[off2->GetIndex()];
-			if (li[p2] < 0) {
+			const auto p2 = (*p)[off2->GetIndex()];
+			if ((*li)[p2] < 0) {
 				// Only mark rhs matches.
 				bit_mask.SetValid(p2);
 				bloom_filter.SetValid(p2 / BLOOM_CHUNK_BITS);
@@ -529,39 +551,26 @@ static idx_t NextValid(const ValidityMask &bits, idx_t j, const idx_t n) {
 		return n;
 	}
 
-	// We can do a first approximation by checking entries one at a time
-	// which gives 64:1.
+	// Check the entries one at a time, which gives 64:1,
+	// and find the first bit that is set in an entry from its trailing zeros
 	idx_t entry_idx, idx_in_entry;
 	bits.GetEntryIndex(j, entry_idx, idx_in_entry);
-	auto entry = bits.GetValidityEntry(entry_idx++);
+	auto entry = bits.GetValidityEntry(entry_idx);
 
 	// Trim the bits before the start position
 	entry &= (ValidityMask::ValidityBuffer::MAX_ENTRY << idx_in_entry);
 
-	// Check the non-ragged entries
-	for (const auto entry_count = bits.EntryCount(n); entry_idx < entry_count; ++entry_idx) {
+	for (const auto entry_count = bits.EntryCount(n);;) {
 		if (entry) {
-			for (; idx_in_entry < bits.BITS_PER_VALUE; ++idx_in_entry, ++j) {
-				if (bits.RowIsValid(entry, idx_in_entry)) {
-					return j;
-				}
-			}
-		} else {
-			j += bits.BITS_PER_VALUE - idx_in_entry;
+			// Bits of the final entry may be set beyond n
+			j = entry_idx * ValidityMask::BITS_PER_VALUE + CountZeros<validity_t>::Trailing(entry);
+			return MinValue(j, n);
 		}
-
-		entry = bits.GetValidityEntry(entry_idx);
-		idx_in_entry = 0;
-	}
-
-	// Check the final entry
-	for (; j < n; ++idx_in_entry, ++j) {
-		if (bits.RowIsValid(entry, idx_in_entry)) {
-			return j;
+		if (++entry_idx >= entry_count) {
+			return n;
 		}
+		entry = bits.GetValidityEntry(entry_idx);
 	}
-
-	return j;
 }
 
 idx_t IEJoinUnion::JoinComplexBlocks(SelectionVector &lsel, SelectionVector &rsel) {
@@ -569,7 +578,7 @@ idx_t IEJoinUnion::JoinComplexBlocks(SelectionVector &lsel, SelectionVector &rse
 	idx_t result_count = 0;
 
 	// 11. for(i←1 to n) do
-	while (i < n) {
+	while (i < end) {
 		// 13. for (j ← pos+eqOff to n) do
 		for (;;) {
 			// 14. if B[j] = 1 then
@@ -591,7 +600,7 @@ idx_t IEJoinUnion::JoinComplexBlocks(SelectionVector &lsel, SelectionVector &rse
 			}
 
 			// Filter out tuples with the same sign (they come from the same table)
-			const auto rrid = li[j];
+			const auto rrid = (*li)[j];
 			++j;
 
 			D_ASSERT(lrid > 0 && rrid < 0);
@@ -766,11 +775,19 @@ void PhysicalIEJoin::ResolveComplexJoin(ExecutionContext &context, DataChunk &re
 	} while (result.size() == 0);
 }
 
+//! A range of the rows of L2 of a block pair that was split off for another thread
+struct IEJoinPairRange {
+	idx_t left_block_index;
+	idx_t right_block_index;
+	unique_ptr<IEJoinUnion> joiner;
+};
+
 class IEJoinGlobalSourceState : public GlobalSourceState {
 public:
-	explicit IEJoinGlobalSourceState(const PhysicalIEJoin &op, IEJoinGlobalState &gsink)
-	    : op(op), gsink(gsink), initialized(false), next_pair(0), completed(0), left_outers(0), next_left(0),
-	      right_outers(0), next_right(0) {
+	explicit IEJoinGlobalSourceState(ClientContext &context, const PhysicalIEJoin &op, IEJoinGlobalState &gsink)
+	    : op(op), gsink(gsink), initialized(false), next_pair(0), sorted(0), split(0), completed(0), left_outers(0),
+	      next_left(0), right_outers(0), next_right(0) {
+		threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
 	}
 
 	void Initialize() {
@@ -813,12 +830,69 @@ public:
 
 public:
 	idx_t MaxThreads() override {
-		// We can't leverage any more threads than block pairs.
+		// We can't leverage any more threads than block pairs, unless the pairs are large enough to be split.
 		const auto &sink_state = (op.sink_state->Cast<IEJoinGlobalState>());
-		return sink_state.tables[0]->BlockCount() * sink_state.tables[1]->BlockCount();
+		auto &left_table = *sink_state.tables[0];
+		auto &right_table = *sink_state.tables[1];
+		const auto left_blocks = left_table.BlockCount();
+		const auto right_blocks = right_table.BlockCount();
+		const auto pair_rows = left_table.count * right_blocks + right_table.count * left_blocks;
+		return MaxValue<idx_t>(left_blocks * right_blocks, pair_rows / IEJoinUnion::MIN_RANGE_ROWS);
+	}
+
+	void SetPair(IEJoinLocalSourceState &lstate, const idx_t b1, const idx_t b2) {
+		lstate.left_block_index = b1;
+		lstate.left_base = left_bases[b1];
+
+		lstate.right_block_index = b2;
+		lstate.right_base = right_bases[b2];
+	}
+
+	//! Split the rows of L2 of the pair of a joiner into ranges for the threads that would be idle otherwise
+	void SplitPair(IEJoinLocalSourceState &lstate, const idx_t remaining_pairs) {
+		auto &joiner = *lstate.joiner;
+		if (remaining_pairs >= threads) {
+			return;
+		}
+		const auto range_count = MinValue<idx_t>(threads - remaining_pairs, joiner.n / IEJoinUnion::MIN_RANGE_ROWS);
+		if (range_count < 2) {
+			return;
+		}
+		const auto range_size = (joiner.n + range_count - 1) / range_count;
+
+		vector<IEJoinPairRange> pair_ranges;
+		for (auto begin = range_size; begin < joiner.n; begin += range_size) {
+			const auto end = MinValue(begin + range_size, joiner.n);
+			IEJoinPairRange range;
+			range.left_block_index = lstate.left_block_index;
+			range.right_block_index = lstate.right_block_index;
+			range.joiner = make_uniq<IEJoinUnion>(op, joiner, begin, end);
+			pair_ranges.emplace_back(std::move(range));
+		}
+		joiner.end = MinValue(joiner.end, range_size);
+
+		auto guard = Lock();
+		split += pair_ranges.size();
+		for (auto &range : pair_ranges) {
+			ranges.emplace_back(std::move(range));
+		}
 	}
 
-	void GetNextPair(ClientContext &client, IEJoinLocalSourceState &lstate) {
+	//! Take the next range that was split off a pair (must hold the lock)
+	bool NextRange(const unique_lock<mutex> &guard, IEJoinLocalSourceState &lstate) {
+		if (ranges.empty()) {
+			return false;
+		}
+		auto &range = ranges.back();
+		SetPair(lstate, range.left_block_index, range.right_block_index);
+		lstate.joiner = std::move(range.joiner);
+		ranges.pop_back();
+		return true;
+	}
+
+	//! Assign the next pair, range or outer block to the thread. Returns false if the thread has to wait for pairs that
+	//! other threads are still sorting or joining, in which case its task has been blocked
+	bool GetNextPair(ClientContext &client, IEJoinLocalSourceState &lstate, const InterruptState &interrupt_state) {
 		auto &left_table = *gsink.tables[0];
 		auto &right_table = *gsink.tables[1];
 
@@ -826,29 +900,62 @@ public:
 		const auto right_blocks = right_table.BlockCount();
 		const auto pair_count = left_blocks * right_blocks;
 
+		// Ranges of pairs that have been split
+		{
+			auto guard = Lock();
+			if (NextRange(guard, lstate)) {
+				return true;
+			}
+		}
+
 		// Regular block
 		const auto i = next_pair++;
 		if (i < pair_count) {
 			const auto b1 = i / right_blocks;
 			const auto b2 = i % right_blocks;
 
-			lstate.left_block_index = b1;
-			lstate.left_base = left_bases[b1];
+			SetPair(lstate, b1, b2);
+			lstate.joiner = make_uniq<IEJoinUnion>(client, op, left_table, b1, right_table, b2);
 
-			lstate.right_block_index = b2;
-			lstate.right_base = right_bases[b2];
+			SplitPair(lstate, pair_count - MinValue<idx_t>(next_pair, pair_count));
+			auto guard = Lock();
+			++sorted;
+			// The waiting threads can take the ranges that were split off, or move on to the outer joins
+			UnblockTasks(guard);
+			return true;
+		}
 
-			lstate.joiner = make_uniq<IEJoinUnion>(client, op, left_table, b1, right_table, b2);
-			return;
+		// Wait for the pairs that are being sorted, they may be split into ranges
+		for (;;) {
+			auto guard = Lock();
+			if (NextRange(guard, lstate)) {
+				return true;
+			}
+			if (sorted >= pair_count) {
+				break;
+			}
+			if (BlockTask(guard, interrupt_state)) {
+				return false;
+			}
+			guard.unlock();
+			std::this_thread::yield();
 		}
 
 		// Outer joins
 		if (!left_outers && !right_outers) {
-			return;
+			return true;
 		}
 
-		// Spin wait for regular blocks to finish(!)
-		while (completed < pair_count) {
+		// Wait for regular blocks to finish(!)
+		for (;;) {
+			auto guard = Lock();
+			if (completed >= pair_count + split) {
+				break;
+			}
+			if (BlockTask(guard, interrupt_state)) {
+				return false;
+			}
+			guard.unlock();
 			std::this_thread::yield();
 		}
 
@@ -862,7 +969,7 @@ public:
 			lstate.left_matches = left_table.found_match.get() + lstate.left_base;
 			lstate.outer_idx = 0;
 			lstate.outer_count = left_table.BlockSize(l);
-			return;
+			return true;
 		} else {
 			lstate.left_matches = nullptr;
 		}
@@ -877,16 +984,22 @@ public:
 			lstate.right_matches = right_table.found_match.get() + lstate.right_base;
 			lstate.outer_idx = 0;
 			lstate.outer_count = right_table.BlockSize(r);
-			return;
+			return true;
 		} else {
 			lstate.right_matches = nullptr;
 		}
+		return true;
 	}
 
-	void PairCompleted(ClientContext &client, IEJoinLocalSourceState &lstate) {
+	bool PairCompleted(ClientContext &client, IEJoinLocalSourceState &lstate, const InterruptState &interrupt_state) {
 		lstate.joiner.reset();
-		++completed;
-		GetNextPair(client, lstate);
+		{
+			auto guard = Lock();
+			++completed;
+			// The outer joins wait for all pairs to be completed
+			UnblockTasks(guard);
+		}
+		return GetNextPair(client, lstate, interrupt_state);
 	}
 
 	double GetProgress() const {
@@ -897,7 +1010,7 @@ public:
 		const auto right_blocks = right_table.BlockCount();
 		const auto pair_count = left_blocks * right_blocks;
 
-		const auto count = pair_count + left_outers + right_outers;
+		const auto count = pair_count + split + left_outers + right_outers;
 
 		const auto l = MinValue(next_left.load(), left_outers.load());
 		const auto r = MinValue(next_right.load(), right_outers.load());
@@ -911,9 +1024,19 @@ public:
 
 	bool initialized;
 
+	//! The number of threads
+	idx_t threads;
+
 	// Join queue state
 	atomic<size_t> next_pair;
+	//! The number of pairs that have been sorted (and split)
+	atomic<size_t> sorted;
+	//! The number of ranges that were split off pairs
+	atomic<size_t> split;
+	//! The number of pairs and ranges that have been joined
 	atomic<size_t> completed;
+	//! The ranges that have been split off pairs and not joined yet
+	vector<IEJoinPairRange> ranges;
 
 	// Block base row number
 	vector<idx_t> left_bases;
@@ -929,7 +1052,7 @@ public:
 
 unique_ptr<GlobalSourceState> PhysicalIEJoin::GetGlobalSourceState(ClientContext &context) const {
 	auto &gsink = sink_state->Cast<IEJoinGlobalState>();
-	return make_uniq<IEJoinGlobalSourceState>(*this, gsink);
+	return make_uniq<IEJoinGlobalSourceState>(context, *this, gsink);
 }
 
 unique_ptr<LocalSourceState> PhysicalIEJoin::GetLocalSourceState(ExecutionContext &context,
@@ -951,7 +1074,9 @@ SourceResultType PhysicalIEJoin::GetData(ExecutionContext &context, DataChunk &r
 	ie_gstate.Initialize();
 
 	if (!ie_lstate.joiner && !ie_lstate.left_matches && !ie_lstate.right_matches) {
-		ie_gstate.GetNextPair(context.client, ie_lstate);
+		if (!ie_gstate.GetNextPair(context.client, ie_lstate, input.interrupt_state)) {
+			return SourceResultType::BLOCKED;
+		}
 	}
 
 	// Process INNER results
@@ -962,7 +1087,9 @@ SourceResultType PhysicalIEJoin::GetData(ExecutionContext &context, DataChunk &r
 			return SourceResultType::HAVE_MORE_OUTPUT;
 		}
 
-		ie_gstate.PairCompleted(context.client, ie_lstate);
+		if (!ie_gstate.PairCompleted(context.client, ie_lstate, input.interrupt_state)) {
+			return SourceResultType::BLOCKED;
+		}
 	}
 
 	// Process LEFT OUTER results
@@ -970,7 +1097,9 @@ SourceResultType PhysicalIEJoin::GetData(ExecutionContext &context, DataChunk &r
 	while (ie_lstate.left_matches) {
 		const idx_t count = ie_lstate.SelectOuterRows(ie_lstate.left_matches);
 		if (!count) {
-			ie_gstate.GetNextPair(context.client, ie_lstate);
+			if (!ie_gstate.GetNextPair(context.client, ie_lstate, input.interrupt_state)) {
+				return SourceResultType::BLOCKED;
+			}
 			continue;
 		}
 		auto &chunk = ie_lstate.unprojected;
@@ -995,7 +1124,9 @@ SourceResultType PhysicalIEJoin::GetData(ExecutionContext &context, DataChunk &r
 	while (ie_lstate.right_matches) {
 		const idx_t count = ie_lstate.SelectOuterRows(ie_lstate.right_matches);
 		if (!count) {
-			ie_gstate.GetNextPair(context.client, ie_lstate);
+			if (!ie_gstate.GetNextPair(context.client, ie_lstate, input.interrupt_state)) {
+				return SourceResultType::BLOCKED;
+			}
 			continue;
 		}
 
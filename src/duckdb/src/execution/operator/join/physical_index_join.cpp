@@ -0,0 +1,166 @@
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/art/art_key.hpp"
+#include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+
+namespace duckdb {
+
+PhysicalIndexJoin::PhysicalIndexJoin(vector<LogicalType> types, unique_ptr<PhysicalOperator> probe,
+                                     unique_ptr<Expression> probe_key_p, vector<idx_t> probe_projection_map_p,
+                                     DuckTableEntry &table, string index_name_p, vector<StorageIndex> fetch_ids_p,
+                                     vector<LogicalType> fetch_types_p, bool probe_first, idx_t estimated_cardinality)
+    : CachingPhysicalOperator(PhysicalOperatorType::INDEX_JOIN, std::move(types), estimated_cardinality),
+      probe_key(std::move(probe_key_p)), probe_projection_map(std::move(probe_projection_map_p)), table(table),
+      index_name(std::move(index_name_p)), fetch_ids(std::move(fetch_ids_p)), fetch_types(std::move(fetch_types_p)),
+      probe_first(probe_first) {
+	children.push_back(std::move(probe));
+	if (probe_projection_map.empty()) {
+		for (idx_t i = 0; i < children[0]->types.size(); i++) {
+			probe_projection_map.push_back(i);
+		}
+	}
+}
+
+class IndexJoinOperatorState : public CachingOperatorState {
+public:
+	IndexJoinOperatorState(ExecutionContext &context, const PhysicalIndexJoin &op)
+	    : probe_executor(context.client, *op.probe_key), arena_allocator(BufferAllocator::Get(context.client)),
+	      keys(STANDARD_VECTOR_SIZE), matches(STANDARD_VECTOR_SIZE), probe_sel(STANDARD_VECTOR_SIZE) {
+		join_keys.Initialize(context.client, {op.probe_key->return_type});
+
+		auto fetch_types = op.fetch_types;
+		fetch_types.push_back(LogicalType::ROW_TYPE);
+		fetched.Initialize(context.client, fetch_types);
+		fetch_ids = op.fetch_ids;
+		fetch_ids.emplace_back(COLUMN_IDENTIFIER_ROW_ID);
+
+		auto &storage = op.table.GetStorage();
+		storage.GetDataTableInfo()->GetIndexes().ScanBound<ART>([&](ART &art_index) {
+			if (art_index.GetIndexName() == op.index_name) {
+				art = &art_index;
+				return true;
+			}
+			return false;
+		});
+		if (!art) {
+			throw InternalException("Index \"%s\" of the index join could not be found", op.index_name);
+		}
+	}
+
+	ExpressionExecutor probe_executor;
+	DataChunk join_keys;
+	ArenaAllocator arena_allocator;
+	unsafe_vector<ARTKey> keys;
+	optional_ptr<ART> art;
+
+	//! The row ids of the table matching each row of the current probe chunk
+	vector<unsafe_vector<row_t>> matches;
+	//! Whether the current probe chunk has been looked up in the index
+	bool probed = false;
+	//! The position of the next match to emit
+	idx_t probe_idx = 0;
+	idx_t match_idx = 0;
+
+	//! The (probe row, row id) pairs to fetch for the next output chunk
+	SelectionVector probe_sel;
+	unsafe_vector<row_t> fetch_rows;
+	vector<StorageIndex> fetch_ids;
+	DataChunk fetched;
+	ColumnFetchState fetch_state;
+
+public:
+	void Finalize(const PhysicalOperator &op, ExecutionContext &context) override {
+		context.thread.profiler.Flush(op);
+	}
+};
+
+unique_ptr<OperatorState> PhysicalIndexJoin::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<IndexJoinOperatorState>(context, *this);
+}
+
+OperatorResultType PhysicalIndexJoin::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                      GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<IndexJoinOperatorState>();
+	auto &transaction = DuckTransaction::Get(context.client, table.catalog);
+	auto &storage = table.GetStorage();
+
+	if (!state.probed) {
+		// compute the join keys of the probe chunk and look them up in the index
+		state.join_keys.Reset();
+		state.probe_executor.Execute(input, state.join_keys);
+		state.arena_allocator.Reset();
+		ART::GenerateKeys<>(state.arena_allocator, state.join_keys, state.keys);
+		{
+			auto checkpoint_lock = storage.GetSharedCheckpointLock();
+			state.art->LookupRowIds(state.keys, input.size(), state.matches);
+		}
+		state.probed = true;
+		state.probe_idx = 0;
+		state.match_idx = 0;
+	}
+
+	// collect up to STANDARD_VECTOR_SIZE matches
+	idx_t fetch_count = 0;
+	state.fetch_rows.clear();
+	while (fetch_count < STANDARD_VECTOR_SIZE && state.probe_idx < input.size()) {
+		auto &probe_matches = state.matches[state.probe_idx];
+		if (state.match_idx < probe_matches.size()) {
+			state.probe_sel.set_index(fetch_count++, state.probe_idx);
+			state.fetch_rows.push_back(probe_matches[state.match_idx++]);
+		} else {
+			state.probe_idx++;
+			state.match_idx = 0;
+		}
+	}
+
+	// fetch the matching rows - the index also contains rows that are not visible to this transaction, which Fetch
+	// skips, so we use the fetched row ids to find the probe rows that still have a match
+	idx_t result_count = 0;
+	state.fetched.Reset();
+	if (fetch_count > 0) {
+		Vector row_ids(LogicalType::ROW_TYPE, data_ptr_cast(state.fetch_rows.data()));
+		storage.Fetch(transaction, state.fetched, state.fetch_ids, row_ids, fetch_count, state.fetch_state);
+
+		auto fetched_row_ids = FlatVector::GetData<row_t>(state.fetched.data.back());
+		for (idx_t i = 0; i < fetch_count && result_count < state.fetched.size(); i++) {
+			if (fetched_row_ids[result_count] == state.fetch_rows[i]) {
+				state.probe_sel.set_index(result_count++, state.probe_sel.get_index(i));
+			}
+		}
+		D_ASSERT(result_count == state.fetched.size());
+	}
+
+	// construct the result
+	idx_t probe_offset = probe_first ? 0 : fetch_types.size();
+	idx_t fetch_offset = probe_first ? probe_projection_map.size() : 0;
+	for (idx_t i = 0; i < probe_projection_map.size(); i++) {
+		chunk.data[probe_offset + i].Slice(input.data[probe_projection_map[i]], state.probe_sel, result_count);
+	}
+	for (idx_t i = 0; i < fetch_types.size(); i++) {
+		chunk.data[fetch_offset + i].Reference(state.fetched.data[i]);
+	}
+	chunk.SetCardinality(result_count);
+
+	if (state.probe_idx < input.size()) {
+		return OperatorResultType::HAVE_MORE_OUTPUT;
+	}
+	state.probed = false;
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+InsertionOrderPreservingMap<string> PhysicalIndexJoin::ParamsToString() const {
+	InsertionOrderPreservingMap<string> result;
+	result["Table"] = table.name;
+	result["Index"] = index_name;
+	result["Probe Key"] = probe_key->GetName();
+	SetEstimatedCardinality(result, estimated_cardinality);
+	return result;
+}
+
+} // namespace duckdb
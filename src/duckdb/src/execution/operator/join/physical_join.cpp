@@ -11,6 +11,11 @@ PhysicalJoin::PhysicalJoin(LogicalOperator &op, PhysicalOperatorType type, JoinT
     : CachingPhysicalOperator(type, op.types, estimated_cardinality), join_type(join_type) {
 }
 
+PhysicalJoin::PhysicalJoin(PhysicalOperatorType type, vector<LogicalType> types, JoinType join_type,
+                           idx_t estimated_cardinality)
+    : CachingPhysicalOperator(type, std::move(types), estimated_cardinality), join_type(join_type) {
+}
+
 bool PhysicalJoin::EmptyResultIfRHSIsEmpty() const {
 	// empty RHS with INNER, RIGHT or SEMI join means empty result set
 	switch (join_type) {
@@ -3,10 +3,18 @@
 #include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
+#include "duckdb/common/multi_file_index.hpp"
+#include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/uuid.hpp"
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/execution_context.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/base_pipeline_event.hpp"
+#include "duckdb/parallel/executor_task.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/operator/logical_copy_to_file.hpp"
 
 #include <algorithm>
@@ -48,9 +56,13 @@ using vector_of_value_map_t = unordered_map<vector<Value>, T, VectorOfValuesHash
 class CopyToFunctionGlobalState : public GlobalSinkState {
 public:
 	explicit CopyToFunctionGlobalState(ClientContext &context, unique_ptr<GlobalFunctionData> global_state)
-	    : rows_copied(0), last_file_offset(0), global_state(std::move(global_state)) {
+	    : rows_copied(0), last_file_offset(0), global_state(std::move(global_state)), spill_partitions(false),
+	      next_spilled_partition(0) {
 		max_open_files = ClientConfig::GetConfig(context).partitioned_write_max_open_files;
 	}
+	//! The amount of radix bits used to partition the spilled data
+	static constexpr idx_t SPILL_RADIX_BITS = 6;
+
 	StorageLock lock;
 	atomic<idx_t> rows_copied;
 	atomic<idx_t> last_file_offset;
@@ -63,6 +75,35 @@ public:
 	vector<Value> file_names;
 	//! Max open files
 	idx_t max_open_files;
+	//! Whether there are more partitions than max_open_files: if so, data is spilled instead of written directly
+	atomic<bool> spill_partitions;
+	//! The spilled data, partitioned on the hash of the partition columns
+	unique_ptr<RadixPartitionedColumnData> spilled_data;
+	//! The next partition of the spilled data that is written
+	atomic<idx_t> next_spilled_partition;
+
+	static vector<LogicalType> GetSpillTypes(const PhysicalCopyToFile &op) {
+		auto types = op.expected_types;
+		types.push_back(LogicalType::HASH);
+		return types;
+	}
+
+	void InitializeSpill(ClientContext &context, const PhysicalCopyToFile &op) {
+		auto types = GetSpillTypes(op);
+		spilled_data = make_uniq<RadixPartitionedColumnData>(context, types, SPILL_RADIX_BITS, types.size() - 1);
+	}
+
+	//! Whether data should be spilled, i.e., whether there are too many partitions to keep a file open for each one
+	bool ShouldSpill() {
+		if (spill_partitions) {
+			return true;
+		}
+		lock_guard<mutex> guard(partition_state->lock);
+		if (partition_state->partition_map.size() > max_open_files) {
+			spill_partitions = true;
+		}
+		return spill_partitions;
+	}
 
 	void CreateDir(const string &dir_path, FileSystem &fs) {
 		if (created_directories.find(dir_path) != created_directories.end()) {
@@ -113,6 +154,44 @@ public:
 		}
 	}
 
+	//! Finalize the partitions that nobody is writing to: once data is spilled, no more tuples are written directly
+	void FinalizeIdlePartitions(ClientContext &context, const PhysicalCopyToFile &op) {
+		auto global_lock = lock.GetExclusiveLock();
+		for (auto it = active_partitioned_writes.begin(); it != active_partitioned_writes.end();) {
+			if (it->second->active_writes == 0) {
+				FinalizePartition(context, op, *it->second);
+				it = active_partitioned_writes.erase(it);
+			} else {
+				it++;
+			}
+		}
+	}
+
+	unique_ptr<GlobalFunctionData> CreatePartitionFile(ClientContext &context, const PhysicalCopyToFile &op,
+	                                                   const vector<Value> &values, StorageLockKey &global_lock) {
+		D_ASSERT(global_lock.GetType() == StorageLockType::EXCLUSIVE);
+		// every file of a partition gets its own offset
+		auto offset = previous_partitions[values]++;
+		auto &fs = FileSystem::GetFileSystem(context);
+		auto trimmed_path = op.GetTrimmedPath(context);
+		string hive_path = GetOrCreateDirectory(op.partition_columns, op.names, values, trimmed_path, fs);
+		string full_path(op.filename_pattern.CreateFilename(fs, hive_path, op.file_extension, offset));
+		if (op.overwrite_mode == CopyOverwriteMode::COPY_APPEND) {
+			// when appending, we first check if the file exists
+			while (fs.FileExists(full_path)) {
+				// file already exists - re-generate name
+				if (!op.filename_pattern.HasUUID()) {
+					throw InternalException("CopyOverwriteMode::COPY_APPEND without {uuid} - and file exists");
+				}
+				full_path = op.filename_pattern.CreateFilename(fs, hive_path, op.file_extension, offset);
+			}
+		}
+		if (op.return_type == CopyFunctionReturnType::CHANGED_ROWS_AND_FILE_LIST || op.file_index) {
+			AddFileName(global_lock, full_path);
+		}
+		return op.function.copy_to_initialize_global(context, *op.bind_data, full_path);
+	}
+
 	PartitionWriteInfo &GetPartitionWriteInfo(ExecutionContext &context, const PhysicalCopyToFile &op,
 	                                          const vector<Value> &values) {
 		auto global_lock = lock.GetExclusiveLock();
@@ -120,8 +199,15 @@ public:
 		auto active_write_entry = active_partitioned_writes.find(values);
 		if (active_write_entry != active_partitioned_writes.end()) {
 			// we have - continue writing in this partition
-			active_write_entry->second->active_writes++;
-			return *active_write_entry->second;
+			auto &info = *active_write_entry->second;
+			if (info.active_writes == 0 && op.rotate &&
+			    op.function.rotate_next_file(*info.global_state, *op.bind_data, op.file_size_bytes)) {
+				// nobody is writing to the current file of this partition and it is full - continue in a new file
+				FinalizePartition(context.client, op, info);
+				info.global_state = CreatePartitionFile(context.client, op, values, *global_lock);
+			}
+			info.active_writes++;
+			return info;
 		}
 		// check if we need to close any writers before we can continue
 		if (active_partitioned_writes.size() >= max_open_files) {
@@ -130,38 +216,14 @@ public:
 				if (entry.second->active_writes == 0) {
 					// we can evict this entry - evict the partition
 					FinalizePartition(context.client, op, *entry.second);
-					++previous_partitions[entry.first];
 					active_partitioned_writes.erase(entry.first);
 					break;
 				}
 			}
 		}
-		idx_t offset = 0;
-		auto prev_offset = previous_partitions.find(values);
-		if (prev_offset != previous_partitions.end()) {
-			offset = prev_offset->second;
-		}
-		auto &fs = FileSystem::GetFileSystem(context.client);
-		// Create a writer for the current file
-		auto trimmed_path = op.GetTrimmedPath(context.client);
-		string hive_path = GetOrCreateDirectory(op.partition_columns, op.names, values, trimmed_path, fs);
-		string full_path(op.filename_pattern.CreateFilename(fs, hive_path, op.file_extension, offset));
-		if (op.overwrite_mode == CopyOverwriteMode::COPY_APPEND) {
-			// when appending, we first check if the file exists
-			while (fs.FileExists(full_path)) {
-				// file already exists - re-generate name
-				if (!op.filename_pattern.HasUUID()) {
-					throw InternalException("CopyOverwriteMode::COPY_APPEND without {uuid} - and file exists");
-				}
-				full_path = op.filename_pattern.CreateFilename(fs, hive_path, op.file_extension, offset);
-			}
-		}
-		if (op.return_type == CopyFunctionReturnType::CHANGED_ROWS_AND_FILE_LIST) {
-			AddFileName(*global_lock, full_path);
-		}
 		// initialize writes
 		auto info = make_uniq<PartitionWriteInfo>();
-		info->global_state = op.function.copy_to_initialize_global(context.client, *op.bind_data, full_path);
+		info->global_state = CreatePartitionFile(context.client, op, values, *global_lock);
 		auto &result = *info;
 		info->active_writes = 1;
 		// store in active write map
@@ -177,6 +239,7 @@ public:
 private:
 	//! The active writes per partition (for partitioned write)
 	vector_of_value_map_t<unique_ptr<PartitionWriteInfo>> active_partitioned_writes;
+	//! The amount of files that have been created per partition
 	vector_of_value_map_t<idx_t> previous_partitions;
 };
 
@@ -200,6 +263,12 @@ public:
 
 	idx_t append_count = 0;
 
+	//! Buffers the spilled tuples, partitioned on the hash of their partition columns
+	unique_ptr<PartitionedColumnData> spill_buffer;
+	unique_ptr<PartitionedColumnDataAppendState> spill_append_state;
+	//! The chunk with the spilled tuples and their hashes
+	DataChunk spill_chunk;
+
 	void InitializeAppendState(ClientContext &context, const PhysicalCopyToFile &op,
 	                           CopyToFunctionGlobalState &gstate) {
 		part_buffer = make_uniq<HivePartitionedColumnData>(context, op.expected_types, op.partition_columns,
@@ -215,12 +284,70 @@ public:
 			// re-initialize the append
 			InitializeAppendState(context.client, op, g);
 		}
+		if (g.spill_partitions) {
+			// there are too many partitions to write them directly
+			Spill(context.client, op, g, chunk);
+			return;
+		}
 		part_buffer->Append(*part_buffer_append_state, chunk);
 		append_count += chunk.size();
 		if (append_count >= ClientConfig::GetConfig(context.client).partitioned_write_flush_threshold) {
-			// flush all cached partitions
-			FlushPartitions(context, op, g);
+			if (g.ShouldSpill()) {
+				// spill the buffered partitions instead of opening a file for each of them
+				SpillPartitions(context.client, op, g);
+				g.FinalizeIdlePartitions(context.client, op);
+			} else {
+				// flush all cached partitions
+				FlushPartitions(context, op, g);
+			}
+		}
+	}
+
+	void Spill(ClientContext &context, const PhysicalCopyToFile &op, CopyToFunctionGlobalState &g, DataChunk &chunk) {
+		if (!spill_buffer) {
+			spill_buffer = g.spilled_data->CreateShared();
+			spill_append_state = make_uniq<PartitionedColumnDataAppendState>();
+			spill_buffer->InitializeAppendState(*spill_append_state);
+			spill_chunk.Initialize(context, CopyToFunctionGlobalState::GetSpillTypes(op));
+		}
+		spill_chunk.Reset();
+		for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
+			spill_chunk.data[col_idx].Reference(chunk.data[col_idx]);
+		}
+		auto partition_columns = op.partition_columns;
+		chunk.Hash(partition_columns, spill_chunk.data.back());
+		spill_chunk.SetCardinality(chunk.size());
+		spill_buffer->Append(*spill_append_state, spill_chunk);
+	}
+
+	//! Move the tuples that are buffered in partitions to the spilled data
+	void SpillPartitions(ClientContext &context, const PhysicalCopyToFile &op, CopyToFunctionGlobalState &g) {
+		if (!part_buffer) {
+			return;
+		}
+		part_buffer->FlushAppendState(*part_buffer_append_state);
+		auto &partitions = part_buffer->GetPartitions();
+		for (auto &partition : partitions) {
+			if (!partition) {
+				continue;
+			}
+			for (auto &chunk : partition->Chunks()) {
+				Spill(context, op, g, chunk);
+			}
+			partition.reset();
+		}
+		ResetAppendState();
+	}
+
+	//! Combine the spilled tuples of this thread into the global spilled data
+	void CombineSpill(CopyToFunctionGlobalState &g) {
+		if (!spill_buffer) {
+			return;
 		}
+		spill_buffer->FlushAppendState(*spill_append_state);
+		g.spilled_data->Combine(*spill_buffer);
+		spill_append_state.reset();
+		spill_buffer.reset();
 	}
 
 	void ResetAppendState() {
@@ -229,8 +356,8 @@ public:
 		append_count = 0;
 	}
 
-	void SetDataWithoutPartitions(DataChunk &chunk, const DataChunk &source, const vector<LogicalType> &col_types,
-	                              const vector<idx_t> &part_cols) {
+	static void SetDataWithoutPartitions(DataChunk &chunk, const DataChunk &source,
+	                                     const vector<LogicalType> &col_types, const vector<idx_t> &part_cols) {
 		D_ASSERT(source.ColumnCount() == col_types.size());
 		auto types = LogicalCopyToFile::GetTypesWithoutPartitions(col_types, part_cols, false);
 		chunk.InitializeEmpty(types);
@@ -288,7 +415,7 @@ unique_ptr<GlobalFunctionData> PhysicalCopyToFile::CreateFileState(ClientContext
 	idx_t this_file_offset = g.last_file_offset++;
 	auto &fs = FileSystem::GetFileSystem(context);
 	string output_path(filename_pattern.CreateFilename(fs, file_path, file_extension, this_file_offset));
-	if (return_type == CopyFunctionReturnType::CHANGED_ROWS_AND_FILE_LIST) {
+	if (return_type == CopyFunctionReturnType::CHANGED_ROWS_AND_FILE_LIST || file_index) {
 		g.AddFileName(global_lock, output_path);
 	}
 	return function.copy_to_initialize_global(context, *bind_data, output_path);
@@ -377,6 +504,7 @@ unique_ptr<GlobalSinkState> PhysicalCopyToFile::GetGlobalSinkState(ClientContext
 
 		if (partition_output) {
 			state->partition_state = make_shared_ptr<GlobalHivePartitionState>();
+			state->InitializeSpill(context, *this);
 		}
 
 		return std::move(state);
@@ -480,7 +608,13 @@ SinkCombineResultType PhysicalCopyToFile::Combine(ExecutionContext &context, Ope
 
 	if (partition_output) {
 		// flush all remaining partitions
-		l.FlushPartitions(context, *this, g);
+		if (g.ShouldSpill()) {
+			l.SpillPartitions(context.client, *this, g);
+			g.FinalizeIdlePartitions(context.client, *this);
+		} else {
+			l.FlushPartitions(context, *this, g);
+		}
+		l.CombineSpill(g);
 	} else if (function.copy_to_combine) {
 		if (per_thread_output) {
 			// For PER_THREAD_OUTPUT, we can combine/finalize immediately (if there is a gstate)
@@ -500,12 +634,190 @@ SinkCombineResultType PhysicalCopyToFile::Combine(ExecutionContext &context, Ope
 	return SinkCombineResultType::FINISHED;
 }
 
+//===--------------------------------------------------------------------===//
+// Finalize
+//===--------------------------------------------------------------------===//
+static void WriteFileIndex(ClientContext &context, const PhysicalCopyToFile &op, CopyToFunctionGlobalState &gstate) {
+	if (!op.file_index) {
+		return;
+	}
+	vector<string> files;
+	for (auto &file_name : gstate.file_names) {
+		files.push_back(StringValue::Get(file_name));
+	}
+	auto function = op.function.copy_from_function;
+	MultiFileIndex::IndexFiles(context, op.GetTrimmedPath(context), function, files);
+}
+
+class CopyToWritePartitionsTask : public ExecutorTask {
+public:
+	CopyToWritePartitionsTask(shared_ptr<Event> event_p, ClientContext &context, CopyToFunctionGlobalState &gstate,
+	                          const PhysicalCopyToFile &op)
+	    : ExecutorTask(context, std::move(event_p), op), context(context), gstate(gstate), copy_op(op) {
+	}
+
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		ExecutionContext execution_context(context, *thread_context, nullptr);
+		auto &partitions = gstate.spilled_data->GetPartitions();
+		while (true) {
+			auto partition_idx = gstate.next_spilled_partition++;
+			if (partition_idx >= partitions.size()) {
+				break;
+			}
+			// every partition of the spilled data is written by a single task
+			auto partition = std::move(partitions[partition_idx]);
+			if (partition && partition->Count() > 0) {
+				WritePartition(execution_context, *partition, CopyToFunctionGlobalState::SPILL_RADIX_BITS);
+			}
+		}
+		event->FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	//! Write the tuples of a partition of the spilled data: each partition of the output is written in one go, so
+	//! only one file is open at a time and the row groups are not split up
+	void WritePartition(ExecutionContext &execution_context, ColumnDataCollection &partition, idx_t radix_bits) {
+		// every partition of the output is buffered before it is written: if there are more of them than the
+		// max_open_files, split up the partition on more bits of the hash first
+		const auto hash_col_idx = copy_op.expected_types.size();
+		unordered_set<hash_t> hashes;
+		for (auto &hash_chunk : partition.Chunks({hash_col_idx})) {
+			auto hash_data = FlatVector::GetData<hash_t>(hash_chunk.data[0]);
+			for (idx_t i = 0; i < hash_chunk.size(); i++) {
+				hashes.insert(hash_data[i]);
+			}
+		}
+		const auto max_open_files = MaxValue<idx_t>(gstate.max_open_files, 1);
+		const idx_t max_radix_bits = RadixPartitioning::MAX_RADIX_BITS;
+		if (hashes.size() > max_open_files && radix_bits < max_radix_bits) {
+			auto required_partitions = NextPowerOfTwo((hashes.size() + max_open_files - 1) / max_open_files);
+			auto added_bits = RadixPartitioning::RadixBitsOfPowerOfTwo(required_partitions);
+			auto new_radix_bits = MinValue<idx_t>(radix_bits + added_bits, max_radix_bits);
+			RadixPartitionedColumnData sub_partitions(context, CopyToFunctionGlobalState::GetSpillTypes(copy_op),
+			                                          new_radix_bits, hash_col_idx);
+			PartitionedColumnDataAppendState append_state;
+			sub_partitions.InitializeAppendState(append_state);
+			for (auto &spill_chunk : partition.Chunks()) {
+				sub_partitions.Append(append_state, spill_chunk);
+			}
+			sub_partitions.FlushAppendState(append_state);
+			partition.Reset();
+			for (auto &sub_partition : sub_partitions.GetPartitions()) {
+				if (sub_partition && sub_partition->Count() > 0) {
+					WritePartition(execution_context, *sub_partition, new_radix_bits);
+				}
+				sub_partition.reset();
+			}
+			return;
+		}
+
+		HivePartitionedColumnData part_buffer(context, copy_op.expected_types, copy_op.partition_columns);
+		PartitionedColumnDataAppendState append_state;
+		part_buffer.InitializeAppendState(append_state);
+		DataChunk chunk;
+		chunk.InitializeEmpty(copy_op.expected_types);
+		for (auto &spill_chunk : partition.Chunks()) {
+			// strip the hash column
+			for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
+				chunk.data[col_idx].Reference(spill_chunk.data[col_idx]);
+			}
+			chunk.SetCardinality(spill_chunk.size());
+			part_buffer.Append(append_state, chunk);
+		}
+		part_buffer.FlushAppendState(append_state);
+		partition.Reset();
+
+		auto &output_partitions = part_buffer.GetPartitions();
+		auto partition_key_map = part_buffer.GetReverseMap();
+		for (auto &entry : partition_key_map) {
+			auto &output_partition = output_partitions[entry.first];
+			WriteOutputPartition(execution_context, entry.second->values, *output_partition);
+			output_partition.reset();
+		}
+	}
+
+	void WriteOutputPartition(ExecutionContext &execution_context, const vector<Value> &values,
+	                          ColumnDataCollection &output_partition) {
+		auto &function = copy_op.function;
+		auto &bind_data = *copy_op.bind_data;
+		auto file_state = CreateFile(values);
+		auto local_copy_state = function.copy_to_initialize_local(execution_context, bind_data);
+		for (auto &chunk : output_partition.Chunks()) {
+			if (copy_op.rotate && function.rotate_next_file(*file_state, bind_data, copy_op.file_size_bytes)) {
+				// the file is full - continue in a new file
+				function.copy_to_combine(execution_context, bind_data, *file_state, *local_copy_state);
+				function.copy_to_finalize(context, bind_data, *file_state);
+				file_state = CreateFile(values);
+				local_copy_state = function.copy_to_initialize_local(execution_context, bind_data);
+			}
+			if (copy_op.write_partition_columns) {
+				function.copy_to_sink(execution_context, bind_data, *file_state, *local_copy_state, chunk);
+			} else {
+				DataChunk filtered_chunk;
+				CopyToFunctionLocalState::SetDataWithoutPartitions(filtered_chunk, chunk, copy_op.expected_types,
+				                                                   copy_op.partition_columns);
+				function.copy_to_sink(execution_context, bind_data, *file_state, *local_copy_state, filtered_chunk);
+			}
+		}
+		function.copy_to_combine(execution_context, bind_data, *file_state, *local_copy_state);
+		function.copy_to_finalize(context, bind_data, *file_state);
+	}
+
+	unique_ptr<GlobalFunctionData> CreateFile(const vector<Value> &values) {
+		auto global_lock = gstate.lock.GetExclusiveLock();
+		return gstate.CreatePartitionFile(context, copy_op, values, *global_lock);
+	}
+
+private:
+	ClientContext &context;
+	CopyToFunctionGlobalState &gstate;
+	const PhysicalCopyToFile &copy_op;
+};
+
+class CopyToWritePartitionsEvent : public BasePipelineEvent {
+public:
+	CopyToWritePartitionsEvent(Pipeline &pipeline_p, CopyToFunctionGlobalState &gstate_p,
+	                           const PhysicalCopyToFile &op_p)
+	    : BasePipelineEvent(pipeline_p), gstate(gstate_p), op(op_p) {
+	}
+
+	CopyToFunctionGlobalState &gstate;
+	const PhysicalCopyToFile &op;
+
+public:
+	void Schedule() override {
+		auto &context = pipeline->GetClientContext();
+		// every task has one file open at a time
+		auto num_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+		auto num_tasks = MinValue<idx_t>(num_threads, gstate.spilled_data->GetPartitions().size());
+		num_tasks = MaxValue<idx_t>(MinValue<idx_t>(num_tasks, gstate.max_open_files), 1);
+
+		vector<shared_ptr<Task>> write_tasks;
+		for (idx_t task_idx = 0; task_idx < num_tasks; task_idx++) {
+			write_tasks.push_back(make_uniq<CopyToWritePartitionsTask>(shared_from_this(), context, gstate, op));
+		}
+		SetTasks(std::move(write_tasks));
+	}
+
+	void FinishEvent() override {
+		WriteFileIndex(pipeline->GetClientContext(), op, gstate);
+	}
+};
+
 SinkFinalizeType PhysicalCopyToFile::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                               OperatorSinkFinalizeInput &input) const {
 	auto &gstate = input.global_state.Cast<CopyToFunctionGlobalState>();
 	if (partition_output) {
 		// finalize any outstanding partitions
 		gstate.FinalizePartitions(context, *this);
+		if (gstate.spill_partitions) {
+			// write the spilled partitions
+			auto new_event = make_shared_ptr<CopyToWritePartitionsEvent>(pipeline, gstate, *this);
+			event.InsertEvent(std::move(new_event));
+		} else {
+			WriteFileIndex(context, *this, gstate);
+		}
 		return SinkFinalizeType::READY;
 	}
 	if (per_thread_output) {
@@ -516,6 +828,7 @@ SinkFinalizeType PhysicalCopyToFile::Finalize(Pipeline &pipeline, Event &event,
 			gstate.global_state = CreateFileState(context, *sink_state, *global_lock);
 			function.copy_to_finalize(context, *bind_data, *gstate.global_state);
 		}
+		WriteFileIndex(context, *this, gstate);
 		return SinkFinalizeType::READY;
 	}
 	if (function.copy_to_finalize) {
@@ -529,6 +842,7 @@ SinkFinalizeType PhysicalCopyToFile::Finalize(Pipeline &pipeline, Event &event,
 			MoveTmpFile(context, file_path);
 		}
 	}
+	WriteFileIndex(context, *this, gstate);
 	return SinkFinalizeType::READY;
 }
 
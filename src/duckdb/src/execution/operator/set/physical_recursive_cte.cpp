@@ -3,7 +3,9 @@
 #include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/aggregate_hashtable.hpp"
+#include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/execution/executor.hpp"
+#include "duckdb/execution/operator/join/physical_hash_join.hpp"
 #include "duckdb/execution/operator/scan/physical_column_data_scan.hpp"
 #include "duckdb/parallel/event.hpp"
 #include "duckdb/parallel/meta_pipeline.hpp"
@@ -28,15 +30,36 @@ PhysicalRecursiveCTE::~PhysicalRecursiveCTE() {
 //===--------------------------------------------------------------------===//
 // Sink
 //===--------------------------------------------------------------------===//
+//! The maximum number of radix bits of the partitions of the hash table that eliminates duplicate rows
+static constexpr idx_t MAX_RADIX_BITS = 6;
+
+//! A partition of the hash table that eliminates duplicate rows, so threads only contend for the same partition
+struct RecursiveCTEPartition {
+	mutex lock;
+	unique_ptr<GroupedAggregateHashTable> ht;
+};
+
 class RecursiveCTEState : public GlobalSinkState {
 public:
 	explicit RecursiveCTEState(ClientContext &context, const PhysicalRecursiveCTE &op)
-	    : intermediate_table(context, op.GetTypes()), new_groups(STANDARD_VECTOR_SIZE) {
-		ht = make_uniq<GroupedAggregateHashTable>(context, BufferAllocator::Get(context), op.types,
-		                                          vector<LogicalType>(), vector<BoundAggregateExpression *>());
+	    : intermediate_table(context, op.GetTypes()) {
+		if (op.union_all) {
+			return;
+		}
+		const auto threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+		radix_bits = threads == 1 ? 0 : MinValue<idx_t>(RadixPartitioning::RadixBits(threads), MAX_RADIX_BITS);
+		for (idx_t partition_idx = 0; partition_idx < RadixPartitioning::NumberOfPartitions(radix_bits);
+		     partition_idx++) {
+			auto partition = make_uniq<RecursiveCTEPartition>();
+			partition->ht = make_uniq<GroupedAggregateHashTable>(context, BufferAllocator::Get(context), op.types,
+			                                                     vector<LogicalType>(),
+			                                                     vector<BoundAggregateExpression *>());
+			partitions.push_back(std::move(partition));
+		}
 	}
 
-	unique_ptr<GroupedAggregateHashTable> ht;
+	idx_t radix_bits = 0;
+	vector<unique_ptr<RecursiveCTEPartition>> partitions;
 
 	bool intermediate_empty = true;
 	mutex intermediate_table_lock;
@@ -44,40 +67,109 @@ public:
 	ColumnDataScanState scan_state;
 	bool initialized = false;
 	bool finished_scan = false;
+};
+
+class RecursiveCTELocalState : public LocalSinkState {
+public:
+	RecursiveCTELocalState(ClientContext &context, const PhysicalRecursiveCTE &op, const RecursiveCTEState &gstate)
+	    : intermediate_table(context, op.GetTypes()), hashes(LogicalType::HASH), addresses(LogicalType::POINTER),
+	      new_groups(STANDARD_VECTOR_SIZE) {
+		intermediate_table.InitializeAppend(append_state);
+		for (idx_t partition_idx = 0; partition_idx < gstate.partitions.size(); partition_idx++) {
+			partition_sels.emplace_back(STANDARD_VECTOR_SIZE);
+		}
+		partition_counts.resize(gstate.partitions.size());
+		partition_chunk.InitializeEmpty(op.GetTypes());
+	}
+
+	//! The rows of this thread, which are added to the intermediate table in Combine
+	ColumnDataCollection intermediate_table;
+	ColumnDataAppendState append_state;
+
+	Vector hashes;
+	Vector addresses;
 	SelectionVector new_groups;
+	vector<SelectionVector> partition_sels;
+	vector<idx_t> partition_counts;
+	DataChunk partition_chunk;
 };
 
 unique_ptr<GlobalSinkState> PhysicalRecursiveCTE::GetGlobalSinkState(ClientContext &context) const {
 	return make_uniq<RecursiveCTEState>(context, *this);
 }
 
-idx_t PhysicalRecursiveCTE::ProbeHT(DataChunk &chunk, RecursiveCTEState &state) const {
-	Vector dummy_addresses(LogicalType::POINTER);
-
-	// Use the HT to eliminate duplicate rows
-	idx_t new_group_count = state.ht->FindOrCreateGroups(chunk, dummy_addresses, state.new_groups);
+unique_ptr<LocalSinkState> PhysicalRecursiveCTE::GetLocalSinkState(ExecutionContext &context) const {
+	auto &gstate = sink_state->Cast<RecursiveCTEState>();
+	return make_uniq<RecursiveCTELocalState>(context.client, *this, gstate);
+}
 
-	// we only return entries we have not seen before (i.e. new groups)
-	chunk.Slice(state.new_groups, new_group_count);
+void PhysicalRecursiveCTE::ProbeHT(DataChunk &chunk, RecursiveCTEState &gstate, RecursiveCTELocalState &lstate) const {
+	const auto count = chunk.size();
+	chunk.Hash(lstate.hashes);
+
+	// Use the partitions of the HT to eliminate duplicate rows
+	auto probe_partition = [&](RecursiveCTEPartition &partition, DataChunk &partition_input, Vector &partition_hashes) {
+		idx_t new_group_count;
+		{
+			lock_guard<mutex> guard(partition.lock);
+			new_group_count = partition.ht->FindOrCreateGroups(partition_input, partition_hashes, lstate.addresses,
+			                                                   lstate.new_groups);
+		}
+		// we only return entries we have not seen before (i.e. new groups)
+		if (new_group_count > 0) {
+			partition_input.Slice(lstate.new_groups, new_group_count);
+			lstate.intermediate_table.Append(lstate.append_state, partition_input);
+		}
+	};
+	if (gstate.partitions.size() == 1) {
+		probe_partition(*gstate.partitions[0], chunk, lstate.hashes);
+		return;
+	}
 
-	return new_group_count;
+	lstate.hashes.Flatten(count);
+	const auto hashes = FlatVector::GetData<hash_t>(lstate.hashes);
+	const auto shift = RadixPartitioning::Shift(gstate.radix_bits);
+	const auto mask = RadixPartitioning::Mask(gstate.radix_bits);
+	auto &partition_counts = lstate.partition_counts;
+	std::fill(partition_counts.begin(), partition_counts.end(), 0);
+	for (idx_t i = 0; i < count; i++) {
+		const auto partition_idx = (hashes[i] & mask) >> shift;
+		lstate.partition_sels[partition_idx].set_index(partition_counts[partition_idx]++, i);
+	}
+	for (idx_t partition_idx = 0; partition_idx < gstate.partitions.size(); partition_idx++) {
+		const auto partition_count = partition_counts[partition_idx];
+		if (partition_count == 0) {
+			continue;
+		}
+		auto &sel = lstate.partition_sels[partition_idx];
+		lstate.partition_chunk.Reset();
+		lstate.partition_chunk.Slice(chunk, sel, partition_count);
+		Vector partition_hashes(lstate.hashes, sel, partition_count);
+		probe_partition(*gstate.partitions[partition_idx], lstate.partition_chunk, partition_hashes);
+	}
 }
 
 SinkResultType PhysicalRecursiveCTE::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
 	auto &gstate = input.global_state.Cast<RecursiveCTEState>();
+	auto &lstate = input.local_state.Cast<RecursiveCTELocalState>();
 
-	lock_guard<mutex> guard(gstate.intermediate_table_lock);
 	if (!union_all) {
-		idx_t match_count = ProbeHT(chunk, gstate);
-		if (match_count > 0) {
-			gstate.intermediate_table.Append(chunk);
-		}
+		ProbeHT(chunk, gstate, lstate);
 	} else {
-		gstate.intermediate_table.Append(chunk);
+		lstate.intermediate_table.Append(lstate.append_state, chunk);
 	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
+SinkCombineResultType PhysicalRecursiveCTE::Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const {
+	auto &gstate = input.global_state.Cast<RecursiveCTEState>();
+	auto &lstate = input.local_state.Cast<RecursiveCTELocalState>();
+
+	lock_guard<mutex> guard(gstate.intermediate_table_lock);
+	gstate.intermediate_table.Combine(lstate.intermediate_table);
+	return SinkCombineResultType::FINISHED;
+}
+
 //===--------------------------------------------------------------------===//
 // Source
 //===--------------------------------------------------------------------===//
@@ -124,15 +216,75 @@ SourceResultType PhysicalRecursiveCTE::GetData(ExecutionContext &context, DataCh
 	return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
 }
 
+//! Whether the result of an operator can differ between the iterations of a recursive CTE
+static bool DependsOnIteration(const PhysicalOperator &op) {
+	switch (op.type) {
+	case PhysicalOperatorType::RECURSIVE_CTE_SCAN:
+	case PhysicalOperatorType::CTE_SCAN:
+	case PhysicalOperatorType::DELIM_SCAN:
+	case PhysicalOperatorType::RECURSIVE_CTE:
+	case PhysicalOperatorType::CTE:
+		return true;
+	default:
+		break;
+	}
+	// delim joins keep their join and distinct outside of the children
+	for (auto &child : op.GetChildren()) {
+		if (DependsOnIteration(child.get())) {
+			return true;
+		}
+	}
+	return false;
+}
+
+//! The hash join whose hash table is built by a MetaPipeline (if any)
+static optional_ptr<PhysicalHashJoin> GetHashJoinBuild(const MetaPipeline &meta_pipeline) {
+	if (meta_pipeline.Type() != MetaPipelineType::JOIN_BUILD) {
+		return nullptr;
+	}
+	auto sink = meta_pipeline.GetSink();
+	if (!sink || sink->type != PhysicalOperatorType::HASH_JOIN) {
+		return nullptr;
+	}
+	return sink->Cast<PhysicalHashJoin>();
+}
+
 void PhysicalRecursiveCTE::ExecuteRecursivePipelines(ExecutionContext &context) const {
 	if (!recursive_meta_pipeline) {
 		throw InternalException("Missing meta pipeline for recursive CTE");
 	}
 	D_ASSERT(recursive_meta_pipeline->HasRecursiveCTE());
 
+	// get the MetaPipelines in the recursive_meta_pipeline, except for the join builds that we can reuse
+	vector<shared_ptr<MetaPipeline>> all_meta_pipelines;
+	recursive_meta_pipeline->GetMetaPipelines(all_meta_pipelines, true, false);
+	reference_set_t<const MetaPipeline> reused_meta_pipelines;
+	for (auto &meta_pipeline : all_meta_pipelines) {
+		if (reused_meta_pipelines.find(*meta_pipeline) != reused_meta_pipelines.end()) {
+			continue;
+		}
+		auto join = GetHashJoinBuild(*meta_pipeline);
+		if (!join || !join->CanReuseHashTable()) {
+			continue;
+		}
+		vector<shared_ptr<MetaPipeline>> build_meta_pipelines;
+		meta_pipeline->GetMetaPipelines(build_meta_pipelines, true, false);
+		for (auto &build_meta_pipeline : build_meta_pipelines) {
+			reused_meta_pipelines.insert(*build_meta_pipeline);
+		}
+	}
+	vector<shared_ptr<MetaPipeline>> meta_pipelines;
+	for (auto &meta_pipeline : all_meta_pipelines) {
+		if (reused_meta_pipelines.find(*meta_pipeline) == reused_meta_pipelines.end()) {
+			meta_pipelines.push_back(meta_pipeline);
+		}
+	}
+
 	// get and reset pipelines
 	vector<shared_ptr<Pipeline>> pipelines;
-	recursive_meta_pipeline->GetPipelines(pipelines, true);
+	for (auto &meta_pipeline : meta_pipelines) {
+		meta_pipeline->GetPipelines(pipelines, false);
+	}
 	for (auto &pipeline : pipelines) {
 		auto sink = pipeline->GetSink();
 		if (sink.get() != this) {
@@ -145,9 +297,7 @@ void PhysicalRecursiveCTE::ExecuteRecursivePipelines(ExecutionContext &context)
 		pipeline->ClearSource();
 	}
 
-	// get the MetaPipelines in the recursive_meta_pipeline and reschedule them
-	vector<shared_ptr<MetaPipeline>> meta_pipelines;
-	recursive_meta_pipeline->GetMetaPipelines(meta_pipelines, true, false);
+	// reschedule the MetaPipelines
 	auto &executor = recursive_meta_pipeline->GetExecutor();
 	vector<shared_ptr<Event>> events;
 	executor.ReschedulePipelines(meta_pipelines, events);
@@ -204,6 +354,16 @@ void PhysicalRecursiveCTE::BuildPipelines(Pipeline &current, MetaPipeline &meta_
 	recursive_meta_pipeline->SetRecursiveCTE();
 	recursive_meta_pipeline->Build(*children[1]);
 
+	// the hash tables of joins whose build side does not depend on the iteration are kept between iterations
+	vector<shared_ptr<MetaPipeline>> meta_pipelines;
+	recursive_meta_pipeline->GetMetaPipelines(meta_pipelines, true, true);
+	for (auto &child_meta_pipeline : meta_pipelines) {
+		auto join = GetHashJoinBuild(*child_meta_pipeline);
+		if (join && !DependsOnIteration(*join->children[1])) {
+			join->keep_hash_table = true;
+		}
+	}
+
 	vector<const_reference<PhysicalOperator>> ops;
 	GatherColumnDataScans(*children[1], ops);
 
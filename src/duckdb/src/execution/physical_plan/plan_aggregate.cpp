@@ -1,9 +1,12 @@
 #include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
 #include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/common/unordered_set.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_partitioned_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
+#include "duckdb/execution/operator/order/physical_order.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
@@ -112,6 +115,71 @@ static bool CanUsePartitionedAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+static bool CanUseStreamingAggregate(LogicalAggregate &op, PhysicalOperator &child) {
+	if (op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	for (auto &expression : op.expressions) {
+		auto &aggregate = expression->Cast<BoundAggregateExpression>();
+		if (aggregate.IsDistinct()) {
+			return false;
+		}
+	}
+	vector<column_t> group_columns;
+	for (auto &group_expr : op.groups) {
+		if (group_expr->type != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		group_columns.push_back(group_expr->Cast<BoundReferenceExpression>().index);
+	}
+	// traverse the order-preserving children of the aggregate to find an ORDER BY
+	reference<PhysicalOperator> child_ref(child);
+	while (child_ref.get().type != PhysicalOperatorType::ORDER_BY) {
+		auto &child_op = child_ref.get();
+		switch (child_op.type) {
+		case PhysicalOperatorType::PROJECTION: {
+			auto &projection = child_op.Cast<PhysicalProjection>();
+			for (auto &group_col : group_columns) {
+				auto &expr = projection.select_list[group_col];
+				if (expr->type != ExpressionType::BOUND_REF) {
+					return false;
+				}
+				group_col = expr->Cast<BoundReferenceExpression>().index;
+			}
+			child_ref = *child_op.children[0];
+			break;
+		}
+		case PhysicalOperatorType::FILTER:
+			child_ref = *child_op.children[0];
+			break;
+		default:
+			return false;
+		}
+	}
+	// the rows of a group are adjacent if a prefix of the sort keys consists of exactly the group columns
+	auto &order = child_ref.get().Cast<PhysicalOrder>();
+	unordered_set<column_t> remaining;
+	for (auto &group_col : group_columns) {
+		remaining.insert(order.projections[group_col]);
+	}
+	unordered_set<column_t> sort_columns;
+	for (auto &order_node : order.orders) {
+		if (remaining.empty()) {
+			break;
+		}
+		if (order_node.expression->type != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		auto sort_col = order_node.expression->Cast<BoundReferenceExpression>().index;
+		if (remaining.erase(sort_col) == 0 && sort_columns.find(sort_col) == sort_columns.end()) {
+			// a sort key that is not a group column comes first
+			return false;
+		}
+		sort_columns.insert(sort_col);
+	}
+	return remaining.empty();
+}
+
 static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate &op, vector<idx_t> &bits_per_group) {
 	if (op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
 		return false;
@@ -262,10 +330,13 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 		}
 	} else {
 		// groups! create a GROUP BY aggregator
-		// use a partitioned or perfect hash aggregate if possible
+		// use a streaming, partitioned or perfect hash aggregate if possible
 		vector<column_t> partition_columns;
 		vector<idx_t> required_bits;
-		if (can_use_simple_aggregation && CanUsePartitionedAggregate(context, op, *plan, partition_columns)) {
+		if (CanUseStreamingAggregate(op, *plan)) {
+			groupby = make_uniq_base<PhysicalOperator, PhysicalStreamingAggregate>(
+			    op.types, std::move(op.expressions), std::move(op.groups), op.estimated_cardinality);
+		} else if (can_use_simple_aggregation && CanUsePartitionedAggregate(context, op, *plan, partition_columns)) {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPartitionedAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(partition_columns),
 			    op.estimated_cardinality);
@@ -4,17 +4,21 @@
 #include "duckdb/execution/operator/join/physical_blockwise_nl_join.hpp"
 #include "duckdb/execution/operator/join/physical_cross_product.hpp"
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/operator/join/physical_iejoin.hpp"
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
 #include "duckdb/execution/operator/join/physical_piecewise_merge_join.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
 
 namespace duckdb {
 
@@ -121,6 +125,114 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 	return;
 }
 
+static unique_ptr<PhysicalOperator> PlanIndexJoin(ClientContext &context, LogicalComparisonJoin &op,
+                                                  unique_ptr<PhysicalOperator> &left,
+                                                  unique_ptr<PhysicalOperator> &right) {
+	// we only do this for inner joins with a single equality condition
+	if (op.join_type != JoinType::INNER || op.conditions.size() != 1 ||
+	    op.conditions[0].comparison != ExpressionType::COMPARE_EQUAL) {
+		return nullptr;
+	}
+	// the probe side has to be small, and much smaller than the indexed table (at most 1%)
+	const idx_t INDEX_JOIN_RATIO = 100;
+	auto threshold = ClientConfig::GetConfig(context).index_join_threshold;
+	auto probe_is_cheap = [&](PhysicalOperator &probe, PhysicalOperator &indexed) {
+		return indexed.type == PhysicalOperatorType::TABLE_SCAN && probe.estimated_cardinality <= threshold &&
+		       probe.estimated_cardinality <= indexed.estimated_cardinality / INDEX_JOIN_RATIO;
+	};
+	bool probe_left;
+	if (probe_is_cheap(*left, *right)) {
+		probe_left = true;
+	} else if (probe_is_cheap(*right, *left)) {
+		probe_left = false;
+	} else {
+		return nullptr;
+	}
+	auto &probe = probe_left ? left : right;
+	auto &indexed = probe_left ? right : left;
+	auto &probe_projection_map = probe_left ? op.left_projection_map : op.right_projection_map;
+	auto &table_projection_map = probe_left ? op.right_projection_map : op.left_projection_map;
+	auto &condition = op.conditions[0];
+	auto &probe_key = probe_left ? condition.left : condition.right;
+	auto &table_key = probe_left ? condition.right : condition.left;
+
+	auto &scan = indexed->Cast<PhysicalTableScan>();
+	if (scan.function.name != "seq_scan" || (scan.table_filters && !scan.table_filters->filters.empty()) ||
+	    scan.extra_info.sample_options) {
+		return nullptr;
+	}
+	if (table_key->type != ExpressionType::BOUND_REF) {
+		return nullptr;
+	}
+	switch (table_key->return_type.InternalType()) {
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		// the ART key encoding of floating points does not follow the join semantics of -0.0 and NaN
+		return nullptr;
+	default:
+		break;
+	}
+	auto &table = scan.bind_data->Cast<TableScanBindData>().table;
+	auto &storage = table.GetStorage();
+	if (LocalStorage::Get(context, table.catalog).Find(storage)) {
+		// the index does not contain the rows appended by this transaction
+		// plans with an index join are re-planned before every execution, so this holds when the plan is executed
+		return nullptr;
+	}
+
+	auto get_scan_column = [&](idx_t output_idx) -> const ColumnIndex & {
+		return scan.column_ids[scan.projection_ids.empty() ? output_idx : scan.projection_ids[output_idx]];
+	};
+	auto &key_column = get_scan_column(table_key->Cast<BoundReferenceExpression>().index);
+	if (key_column.IsRowIdColumn() || key_column.HasChildren()) {
+		return nullptr;
+	}
+
+	// find an ART over exactly the join key
+	string index_name;
+	{
+		auto checkpoint_lock = storage.GetSharedCheckpointLock();
+		auto &info = storage.GetDataTableInfo();
+		info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art_index) {
+			auto &expressions = art_index.unbound_expressions;
+			if (expressions.size() != 1 || expressions[0]->type != ExpressionType::BOUND_COLUMN_REF) {
+				return false;
+			}
+			auto &colref = expressions[0]->Cast<BoundColumnRefExpression>();
+			if (art_index.GetColumnIds()[colref.binding.column_index] != key_column.GetPrimaryIndex()) {
+				return false;
+			}
+			index_name = art_index.GetIndexName();
+			return true;
+		});
+	}
+	if (index_name.empty()) {
+		return nullptr;
+	}
+
+	// the index join fetches the projected columns of the table for every match
+	vector<StorageIndex> fetch_ids;
+	vector<LogicalType> fetch_types;
+	auto fetch_count = table_projection_map.empty() ? indexed->types.size() : table_projection_map.size();
+	for (idx_t i = 0; i < fetch_count; i++) {
+		auto output_idx = table_projection_map.empty() ? i : table_projection_map[i];
+		auto &column = get_scan_column(output_idx);
+		if (column.HasChildren()) {
+			return nullptr;
+		}
+		if (column.IsRowIdColumn()) {
+			fetch_ids.emplace_back(COLUMN_IDENTIFIER_ROW_ID);
+		} else {
+			fetch_ids.emplace_back(table.GetColumn(column.ToLogical()).StorageOid());
+		}
+		fetch_types.push_back(indexed->types[output_idx]);
+	}
+
+	return make_uniq<PhysicalIndexJoin>(op.types, std::move(probe), std::move(probe_key), probe_projection_map, table,
+	                                    std::move(index_name), std::move(fetch_ids), std::move(fetch_types),
+	                                    probe_left, op.estimated_cardinality);
+}
+
 static void RewriteJoinCondition(Expression &expr, idx_t offset) {
 	if (expr.type == ExpressionType::BOUND_REF) {
 		auto &ref = expr.Cast<BoundReferenceExpression>();
@@ -168,6 +280,13 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 
 	unique_ptr<PhysicalOperator> plan;
 	if (has_equality && !prefer_range_joins) {
+		// Small probe side against a large table with an ART on the join key: possible index join
+		plan = PlanIndexJoin(context, op, left, right);
+		if (plan) {
+			// the index join was chosen because the transaction has not appended to the table
+			requires_rebind = true;
+			return plan;
+		}
 		// Equality join with small number of keys : possible perfect join optimization
 		PerfectHashJoinStats perfect_join_stats;
 		CheckForPerfectJoinOpt(op, perfect_join_stats);
@@ -58,6 +58,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCopyToFile
 	copy->write_partition_columns = op.write_partition_columns;
 	copy->names = op.names;
 	copy->expected_types = op.expected_types;
+	copy->file_index = op.file_index;
 	copy->parallel = mode == CopyFunctionExecutionMode::PARALLEL_COPY_TO_FILE;
 
 	copy->children.push_back(std::move(plan));
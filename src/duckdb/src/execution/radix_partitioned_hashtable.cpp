@@ -135,6 +135,10 @@ public:
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
+	//! If this fraction of the sunk rows creates a new group, we stop looking up the groups
+	static constexpr const double SKIP_LOOKUPS_THRESHOLD = 0.95;
+	//! After skipping lookups for this many HT fills, we look them up again to check whether the reduction improved
+	static constexpr const idx_t SKIP_LOOKUPS_FILLS = 16;
 };
 
 class RadixHTGlobalSinkState : public GlobalSinkState {
@@ -325,9 +329,15 @@ public:
 
 	//! Data that is abandoned ends up here (only if we're doing external aggregation)
 	unique_ptr<PartitionedTupleData> abandoned_data;
+
+	//! Rows sunk since the HT was last cleared
+	idx_t fill_count;
+	//! HT fills since we started skipping lookups
+	idx_t skipped_fills;
 };
 
-RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht) {
+RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht)
+    : fill_count(0), skipped_fills(0) {
 	// If there are no groups we create a fake group so everything has the same group
 	group_chunk.InitializeEmpty(radix_ht.group_types);
 	if (radix_ht.grouping_set.empty()) {
@@ -443,6 +453,8 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 		lstate.ht =
 		    CreateHT(context.client, GroupedAggregateHashTable::InitialCapacity(), gstate.config.GetRadixBits());
 		gstate.active_threads++;
+		// Record the groups that repeat during the first fill, they stay local if we end up skipping lookups
+		lstate.ht->TrackHotGroups(gstate.number_of_threads > 2 || gstate.external);
 	}
 
 	auto &group_chunk = lstate.group_chunk;
@@ -450,18 +462,41 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 
 	auto &ht = *lstate.ht;
 	ht.AddChunk(group_chunk, payload_input, filter);
+	lstate.fill_count += group_chunk.size();
 
-	if (ht.Count() + STANDARD_VECTOR_SIZE < GroupedAggregateHashTable::ResizeThreshold(gstate.config.sink_capacity)) {
+	// When skipping lookups the HT stays empty, but we still check for repartitioning every so often
+	const auto fill = ht.SkipLookups() ? lstate.fill_count : ht.Count();
+	if (fill + STANDARD_VECTOR_SIZE < GroupedAggregateHashTable::ResizeThreshold(gstate.config.sink_capacity)) {
 		return; // We can fit another chunk
 	}
 
 	if (gstate.number_of_threads > 2 || gstate.external) {
 		// 'Reset' the HT without taking its data, we can just keep appending to the same collection
 		// This only works because we never resize the HT
-		ht.ClearPointerTable();
-		ht.ResetCount();
+		if (ht.SkipLookups()) {
+			// We regularly look up the groups again for a single fill, so that the reduction is re-evaluated
+			// and the hot groups are refreshed if the distribution changes
+			if (++lstate.skipped_fills >= RadixHTConfig::SKIP_LOOKUPS_FILLS) {
+				ht.SetSkipLookups(false);
+				ht.TrackHotGroups(true);
+			}
+		} else {
+			// If almost every row created a new group, probing the HT is wasted effort:
+			// we append the rows directly and leave the aggregation to the finalize
+			// Only the groups that repeated during this fill (the heavy hitters) are still aggregated here
+			const auto all_unique = static_cast<double>(ht.Count()) >=
+			                        static_cast<double>(lstate.fill_count) * RadixHTConfig::SKIP_LOOKUPS_THRESHOLD;
+			ht.ClearPointerTable();
+			ht.ResetCount();
+			ht.TrackHotGroups(false);
+			if (all_unique) {
+				ht.SetSkipLookups(true);
+				lstate.skipped_fills = 0;
+			}
+		}
 		// We don't do this when running with 1 or 2 threads, it only makes sense when there's many threads
 	}
+	lstate.fill_count = 0;
 
 	// Check if we need to repartition
 	auto repartitioned = MaybeRepartition(context.client, gstate, lstate);
@@ -1407,6 +1407,9 @@ WindowAggregateExecutor::WindowAggregateExecutor(BoundWindowExpression &wexpr, C
 		aggregator = make_uniq<WindowConstantAggregator>(wexpr, wexpr.exclude_clause, shared);
 	} else if (IsCustomAggregate()) {
 		aggregator = make_uniq<WindowCustomAggregator>(wexpr, wexpr.exclude_clause, shared);
+	} else if (mode == WindowAggregationMode::WINDOW && WindowSlidingAggregator::CanAggregate(wexpr)) {
+		// slide a single state along the frames for aggregates that can remove values (and MIN/MAX)
+		aggregator = make_uniq<WindowSlidingAggregator>(wexpr, wexpr.exclude_clause, shared);
 	} else {
 		// build a segment tree for frame-adhering aggregates
 		// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
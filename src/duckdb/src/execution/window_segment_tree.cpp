@@ -1,7 +1,9 @@
 #include "duckdb/execution/window_segment_tree.hpp"
 
 #include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/sort/partition_state.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/merge_sort_tree.hpp"
@@ -1494,6 +1496,486 @@ void WindowSegmentTreePart::EvaluateLeaves(const WindowSegmentTreeGlobalState &t
 	FlushStates(false);
 }
 
+//===--------------------------------------------------------------------===//
+// WindowSlidingAggregator
+//===--------------------------------------------------------------------===//
+static bool IsConstantBoundary(const WindowBoundary boundary, const unique_ptr<Expression> &offset) {
+	switch (boundary) {
+	case WindowBoundary::EXPR_PRECEDING_ROWS:
+	case WindowBoundary::EXPR_FOLLOWING_ROWS:
+	case WindowBoundary::EXPR_PRECEDING_RANGE:
+	case WindowBoundary::EXPR_FOLLOWING_RANGE:
+		//	Variable offsets make the frames jump around
+		return offset && offset->IsFoldable();
+	default:
+		return true;
+	}
+}
+
+static int8_t GetExtreme(const BoundWindowExpression &wexpr) {
+	if (wexpr.children.size() != 1 || wexpr.return_type != wexpr.children[0]->return_type) {
+		return 0;
+	}
+	const auto &name = wexpr.aggregate->name;
+	if (name == "min") {
+		return -1;
+	} else if (name == "max") {
+		return 1;
+	}
+	return 0;
+}
+
+static bool HasMonotonicDeque(const PhysicalType type) {
+	switch (type) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool WindowSlidingAggregator::CanAggregate(const BoundWindowExpression &wexpr) {
+	if (!wexpr.aggregate || wexpr.distinct || wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+		return false;
+	}
+	if (!IsConstantBoundary(wexpr.start, wexpr.start_expr) || !IsConstantBoundary(wexpr.end, wexpr.end_expr)) {
+		return false;
+	}
+	if (GetExtreme(wexpr)) {
+		//	The deque has to be rebuilt from the partition boundary by each thread,
+		//	so unbounded frames are better served by the segment tree
+		if (wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING || wexpr.end == WindowBoundary::UNBOUNDED_FOLLOWING) {
+			return false;
+		}
+		return HasMonotonicDeque(wexpr.return_type.InternalType());
+	}
+
+	//	The removable states are plain values, so they can be copied out for finalisation
+	const auto &aggr = *wexpr.aggregate;
+	return aggr.remove && aggr.simple_update && aggr.combine && !aggr.destructor;
+}
+
+WindowSlidingAggregator::WindowSlidingAggregator(const BoundWindowExpression &wexpr,
+                                                 const WindowExcludeMode exclude_mode, WindowSharedExpressions &shared)
+    : WindowAggregator(wexpr, exclude_mode, shared), extreme(GetExtreme(wexpr)) {
+	D_ASSERT(CanAggregate(wexpr));
+}
+
+//! The aggregate of a range of rows sunk by one thread
+struct WindowSlidingRange {
+	WindowSlidingRange(const AggregateObject &aggr, idx_t begin) : begin(begin), end(begin), valid_count(0) {
+		state.resize(aggr.function.state_size(aggr.function));
+		aggr.function.initialize(aggr.function, state.data());
+	}
+
+	//! The rows in the range
+	idx_t begin;
+	idx_t end;
+	//! The number of rows in the range that updated the state
+	idx_t valid_count;
+	//! The aggregate state of the range
+	vector<data_t> state;
+};
+
+class WindowSlidingGlobalState : public WindowAggregatorGlobalState {
+public:
+	using RangePtr = unique_ptr<WindowSlidingRange>;
+
+	WindowSlidingGlobalState(ClientContext &context, const WindowSlidingAggregator &aggregator, idx_t group_count)
+	    : WindowAggregatorGlobalState(context, aggregator, group_count) {
+	}
+
+	WindowSlidingRange &CreateRange(idx_t begin) {
+		lock_guard<mutex> range_lock(lock);
+		ranges.emplace_back(make_uniq<WindowSlidingRange>(aggr, begin));
+		return *ranges.back();
+	}
+
+	//! The ranges, ordered by their first row once finalized
+	vector<RangePtr> ranges;
+};
+
+unique_ptr<WindowAggregatorState> WindowSlidingAggregator::GetGlobalState(ClientContext &context, idx_t group_count,
+                                                                          const ValidityMask &) const {
+	return make_uniq<WindowSlidingGlobalState>(context, *this, group_count);
+}
+
+//! A monotonic deque of the (row, value) pairs that can still become the MIN/MAX of the frame
+class WindowMonotonicDeque {
+public:
+	virtual ~WindowMonotonicDeque() {
+	}
+
+	virtual void Evaluate(WindowCursor &cursor, const ValidityArray &filter_mask, const DataChunk &bounds,
+	                      Vector &result, idx_t count) = 0;
+};
+
+template <class T, class OP>
+class WindowTypedMonotonicDeque : public WindowMonotonicDeque {
+public:
+	void Evaluate(WindowCursor &cursor, const ValidityArray &filter_mask, const DataChunk &bounds, Vector &result,
+	              idx_t count) override {
+		auto begins = FlatVector::GetData<const idx_t>(bounds.data[FRAME_BEGIN]);
+		auto ends = FlatVector::GetData<const idx_t>(bounds.data[FRAME_END]);
+		auto rdata = FlatVector::GetData<T>(result);
+		auto &rmask = FlatVector::Validity(result);
+
+		for (idx_t i = 0; i < count; ++i) {
+			const auto begin = begins[i];
+			const auto end = MaxValue(begins[i], ends[i]);
+
+			//	Start over if the frame moved backwards or skipped rows
+			if (begin < frame_begin || end < frame_end || begin > frame_end) {
+				window.clear();
+				frame_end = begin;
+			}
+			frame_begin = begin;
+
+			//	Add the new rows, dropping any values they dominate
+			for (; frame_end < end; ++frame_end) {
+				if (!filter_mask.RowIsValid(frame_end) || cursor.CellIsNull(0, frame_end)) {
+					continue;
+				}
+				const auto value = cursor.GetCell<T>(0, frame_end);
+				while (!window.empty() && !OP::Operation(window.back().second, value)) {
+					window.pop_back();
+				}
+				window.emplace_back(frame_end, value);
+			}
+
+			//	Drop the rows that left the frame
+			while (!window.empty() && window.front().first < frame_begin) {
+				window.pop_front();
+			}
+
+			if (window.empty()) {
+				rmask.SetInvalid(i);
+			} else {
+				rdata[i] = window.front().second;
+			}
+		}
+	}
+
+private:
+	deque<std::pair<idx_t, T>> window;
+	idx_t frame_begin = 0;
+	idx_t frame_end = 0;
+};
+
+template <class OP>
+static unique_ptr<WindowMonotonicDeque> CreateMonotonicDeque(const PhysicalType type) {
+	switch (type) {
+	case PhysicalType::INT8:
+		return make_uniq<WindowTypedMonotonicDeque<int8_t, OP>>();
+	case PhysicalType::INT16:
+		return make_uniq<WindowTypedMonotonicDeque<int16_t, OP>>();
+	case PhysicalType::INT32:
+		return make_uniq<WindowTypedMonotonicDeque<int32_t, OP>>();
+	case PhysicalType::INT64:
+		return make_uniq<WindowTypedMonotonicDeque<int64_t, OP>>();
+	case PhysicalType::INT128:
+		return make_uniq<WindowTypedMonotonicDeque<hugeint_t, OP>>();
+	case PhysicalType::UINT8:
+		return make_uniq<WindowTypedMonotonicDeque<uint8_t, OP>>();
+	case PhysicalType::UINT16:
+		return make_uniq<WindowTypedMonotonicDeque<uint16_t, OP>>();
+	case PhysicalType::UINT32:
+		return make_uniq<WindowTypedMonotonicDeque<uint32_t, OP>>();
+	case PhysicalType::UINT64:
+		return make_uniq<WindowTypedMonotonicDeque<uint64_t, OP>>();
+	case PhysicalType::UINT128:
+		return make_uniq<WindowTypedMonotonicDeque<uhugeint_t, OP>>();
+	case PhysicalType::FLOAT:
+		return make_uniq<WindowTypedMonotonicDeque<float, OP>>();
+	case PhysicalType::DOUBLE:
+		return make_uniq<WindowTypedMonotonicDeque<double, OP>>();
+	default:
+		throw InternalException("Unsupported type for windowed MIN/MAX deque");
+	}
+}
+
+class WindowSlidingState : public WindowAggregatorLocalState {
+public:
+	explicit WindowSlidingState(const WindowSlidingAggregator &aggregator);
+	~WindowSlidingState() override {
+	}
+
+	void Sink(WindowSlidingGlobalState &gsink, DataChunk &coll_chunk, idx_t input_idx,
+	          optional_ptr<SelectionVector> filter_sel, idx_t filtered);
+	void Evaluate(const WindowSlidingGlobalState &gsink, const DataChunk &bounds, Vector &result, idx_t count);
+
+protected:
+	//! Move the frame of the running state to [begin, end)
+	void Slide(const WindowSlidingGlobalState &gsink, idx_t begin, idx_t end);
+	//! Add the rows up to end to the running state, combining the sunk ranges that fit
+	void Extend(const WindowSlidingGlobalState &gsink, idx_t end);
+	//! Add or remove the unfiltered rows in [begin, end) to/from the running state
+	void UpdateRange(const WindowAggregatorGlobalState &gsink, idx_t begin, idx_t end, bool remove);
+	//! Reinitialise the running state
+	void ResetState();
+
+	//! The aggregator
+	const WindowSlidingAggregator &aggregator;
+	//! The running aggregate state of the current frame
+	vector<data_t> running;
+	//! Copies of the running state for each result row
+	vector<data_t> state;
+	//! Reused result state container for the aggregate
+	Vector statef;
+	//! Input data chunk, used for updating the running state
+	DataChunk leaves;
+	//! The rows being updated
+	SelectionVector update_sel;
+	//! The frame of the running state
+	idx_t frame_begin;
+	idx_t frame_end;
+	//! The number of rows in the frame with no NULL arguments
+	idx_t valid_count;
+	//! The MIN/MAX deque (if any)
+	unique_ptr<WindowMonotonicDeque> extremes;
+	//! The range of rows sunk by this thread
+	optional_ptr<WindowSlidingRange> range;
+	//! Pointer vectors for combining range states
+	Vector statel;
+	Vector statep;
+};
+
+WindowSlidingState::WindowSlidingState(const WindowSlidingAggregator &aggregator_p)
+    : aggregator(aggregator_p), statef(LogicalType::POINTER), frame_begin(0), frame_end(0), valid_count(0),
+      statel(LogicalType::POINTER), statep(LogicalType::POINTER) {
+	if (aggregator.extreme < 0) {
+		extremes = CreateMonotonicDeque<LessThan>(aggregator.result_type.InternalType());
+		return;
+	} else if (aggregator.extreme > 0) {
+		extremes = CreateMonotonicDeque<GreaterThan>(aggregator.result_type.InternalType());
+		return;
+	}
+
+	running.resize(aggregator.state_size);
+	state.resize(aggregator.state_size * STANDARD_VECTOR_SIZE);
+	update_sel.Initialize();
+	ResetState();
+
+	//	Build the finalise vector that just points to the result states
+	data_ptr_t state_ptr = state.data();
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; ++i) {
+		fdata[i] = state_ptr;
+		state_ptr += aggregator.state_size;
+	}
+}
+
+void WindowSlidingState::ResetState() {
+	const auto &function = aggregator.aggr.function;
+	function.initialize(function, running.data());
+	valid_count = 0;
+}
+
+void WindowSlidingState::Sink(WindowSlidingGlobalState &gsink, DataChunk &coll_chunk, idx_t input_idx,
+                              optional_ptr<SelectionVector> filter_sel, idx_t filtered) {
+	if (extremes) {
+		return;
+	}
+
+	//	Threads sink contiguous blocks, so we only need a new range if we jumped
+	if (!range || range->end != input_idx) {
+		range = gsink.CreateRange(input_idx);
+	}
+	range->end = input_idx + coll_chunk.size();
+
+	const auto &aggr = gsink.aggr;
+	if (leaves.ColumnCount() == 0 && !aggregator.arg_types.empty()) {
+		leaves.Initialize(Allocator::DefaultAllocator(), aggregator.arg_types);
+	}
+	auto count = coll_chunk.size();
+	for (idx_t c = 0; c < leaves.ColumnCount(); ++c) {
+		leaves.data[c].Reference(coll_chunk.data[aggregator.child_idx[c]]);
+	}
+	if (filter_sel) {
+		leaves.Slice(*filter_sel, filtered);
+		count = filtered;
+	}
+	leaves.SetCardinality(count);
+	if (!count) {
+		return;
+	}
+
+	//	Count the rows without NULL arguments
+	idx_t valid = count;
+	if (leaves.ColumnCount()) {
+		auto formats = leaves.ToUnifiedFormat();
+		for (idx_t i = 0; i < count; ++i) {
+			for (idx_t c = 0; c < leaves.ColumnCount(); ++c) {
+				if (!formats[c].validity.RowIsValid(formats[c].sel->get_index(i))) {
+					--valid;
+					break;
+				}
+			}
+		}
+	}
+	range->valid_count += valid;
+
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.simple_update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), range->state.data(), count);
+}
+
+void WindowSlidingState::UpdateRange(const WindowAggregatorGlobalState &gsink, idx_t begin, idx_t end, bool remove) {
+	const auto &aggr = gsink.aggr;
+	auto &filter_mask = gsink.filter_mask;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+
+	auto &scanned = cursor->chunk;
+	for (auto row = begin; row < end;) {
+		cursor->Seek(row);
+		const auto chunk_end = MinValue<idx_t>(end, cursor->state.next_row_index);
+		idx_t nsel = 0;
+		for (; row < chunk_end; ++row) {
+			if (!filter_mask.RowIsValid(row)) {
+				continue;
+			}
+			const auto offset = cursor->RowOffset(row);
+			update_sel.set_index(nsel++, offset);
+
+			//	Track the rows that update the state, so we can tell when the frame becomes empty
+			bool valid = true;
+			for (auto &arg : scanned.data) {
+				valid = valid && FlatVector::Validity(arg).RowIsValid(offset);
+			}
+			if (valid) {
+				valid_count = remove ? valid_count - 1 : valid_count + 1;
+			}
+		}
+		if (!nsel) {
+			continue;
+		}
+
+		leaves.Slice(scanned, update_sel, nsel);
+		auto update = remove ? aggr.function.remove : aggr.function.simple_update;
+		update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), running.data(), nsel);
+	}
+}
+
+void WindowSlidingState::Extend(const WindowSlidingGlobalState &gsink, idx_t end) {
+	//	Short extensions cannot contain a whole range
+	if (end - frame_end < STANDARD_VECTOR_SIZE) {
+		UpdateRange(gsink, frame_end, end, false);
+		frame_end = end;
+		return;
+	}
+
+	//	Find the first range starting after the frame
+	auto &ranges = gsink.ranges;
+	auto it = std::lower_bound(
+	    ranges.begin(), ranges.end(), frame_end,
+	    [](const WindowSlidingGlobalState::RangePtr &range, idx_t row) { return range->begin < row; });
+
+	//	Combine the aggregates of the ranges that fit into the frame instead of scanning them
+	const auto &aggr = gsink.aggr;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	auto ldata = FlatVector::GetData<const_data_ptr_t>(statel);
+	auto pdata = FlatVector::GetData<data_ptr_t>(statep);
+	for (; it != ranges.end() && (*it)->end <= end; ++it) {
+		auto &range = **it;
+		UpdateRange(gsink, frame_end, range.begin, false);
+		ldata[0] = range.state.data();
+		pdata[0] = running.data();
+		aggr.function.combine(statel, statep, aggr_input_data, 1);
+		valid_count += range.valid_count;
+		frame_end = range.end;
+	}
+	UpdateRange(gsink, frame_end, end, false);
+	frame_end = end;
+}
+
+void WindowSlidingState::Slide(const WindowSlidingGlobalState &gsink, idx_t begin, idx_t end) {
+	//	Start over if the frame moved backwards, skipped rows or removing would be more work
+	if (begin < frame_begin || end < frame_end || begin > frame_end || begin - frame_begin > end - begin) {
+		ResetState();
+		frame_begin = frame_end = begin;
+	}
+
+	UpdateRange(gsink, frame_begin, begin, true);
+	frame_begin = begin;
+	Extend(gsink, end);
+
+	//	Removing everything does not necessarily restore the initial state (e.g., SUM remembers it saw a value)
+	if (!valid_count) {
+		ResetState();
+	}
+}
+
+void WindowSlidingState::Evaluate(const WindowSlidingGlobalState &gsink, const DataChunk &bounds, Vector &result,
+                                  idx_t count) {
+	if (extremes) {
+		extremes->Evaluate(*cursor, gsink.filter_mask, bounds, result, count);
+		return;
+	}
+
+	const auto types = cursor->chunk.GetTypes();
+	if (leaves.ColumnCount() == 0 && !types.empty()) {
+		leaves.Initialize(Allocator::DefaultAllocator(), types);
+	}
+
+	auto begins = FlatVector::GetData<const idx_t>(bounds.data[FRAME_BEGIN]);
+	auto ends = FlatVector::GetData<const idx_t>(bounds.data[FRAME_END]);
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+	for (idx_t i = 0; i < count; ++i) {
+		Slide(gsink, begins[i], MaxValue(begins[i], ends[i]));
+		memcpy(fdata[i], running.data(), aggregator.state_size);
+	}
+
+	//	Finalise the copies and write to the result
+	const auto &aggr = gsink.aggr;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.finalize(statef, aggr_input_data, result, count, 0);
+}
+
+unique_ptr<WindowAggregatorState> WindowSlidingAggregator::GetLocalState(const WindowAggregatorState &gstate) const {
+	return make_uniq<WindowSlidingState>(*this);
+}
+
+void WindowSlidingAggregator::Sink(WindowAggregatorState &gsink, WindowAggregatorState &lstate, DataChunk &sink_chunk,
+                                   DataChunk &coll_chunk, idx_t input_idx, optional_ptr<SelectionVector> filter_sel,
+                                   idx_t filtered) {
+	WindowAggregator::Sink(gsink, lstate, sink_chunk, coll_chunk, input_idx, filter_sel, filtered);
+
+	auto &gssink = gsink.Cast<WindowSlidingGlobalState>();
+	auto &lsstate = lstate.Cast<WindowSlidingState>();
+	lsstate.Sink(gssink, coll_chunk, input_idx, filter_sel, filtered);
+}
+
+void WindowSlidingAggregator::Finalize(WindowAggregatorState &gsink, WindowAggregatorState &lstate,
+                                       CollectionPtr collection, const FrameStats &stats) {
+	WindowAggregator::Finalize(gsink, lstate, collection, stats);
+
+	//	All the ranges have been sunk, so order them for searching
+	auto &gssink = gsink.Cast<WindowSlidingGlobalState>();
+	lock_guard<mutex> range_lock(gssink.lock);
+	auto &ranges = gssink.ranges;
+	std::sort(ranges.begin(), ranges.end(),
+	          [](const WindowSlidingGlobalState::RangePtr &lhs, const WindowSlidingGlobalState::RangePtr &rhs) {
+		          return lhs->begin < rhs->begin;
+	          });
+}
+
+void WindowSlidingAggregator::Evaluate(const WindowAggregatorState &gsink, WindowAggregatorState &lstate,
+                                       const DataChunk &bounds, Vector &result, idx_t count, idx_t row_idx) const {
+	const auto &gasink = gsink.Cast<WindowSlidingGlobalState>();
+	auto &lsstate = lstate.Cast<WindowSlidingState>();
+	lsstate.Evaluate(gasink, bounds, result, count);
+}
+
 //===--------------------------------------------------------------------===//
 // WindowDistinctAggregator
 //===--------------------------------------------------------------------===//
@@ -1,6 +1,9 @@
 #include "duckdb/function/pragma/pragma_functions.hpp"
 
+#include "duckdb/catalog/catalog_entry/copy_function_catalog_entry.hpp"
 #include "duckdb/common/enums/output_type.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/multi_file_index.hpp"
 #include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/function/function_set.hpp"
 #include "duckdb/logging/http_logger.hpp"
@@ -122,6 +125,23 @@ static void PragmaDisableOptimizer(ClientContext &context, const FunctionParamet
 	ClientConfig::GetConfig(context).enable_optimizer = false;
 }
 
+static void PragmaCreateFileIndex(ClientContext &context, const FunctionParameters &parameters) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto directory = parameters.values[0].ToString();
+	StringUtil::RTrim(directory, fs.PathSeparator(directory));
+	string format = "parquet";
+	auto entry = parameters.named_parameters.find("format");
+	if (entry != parameters.named_parameters.end()) {
+		format = StringUtil::Lower(entry->second.ToString());
+	}
+	auto &copy_function =
+	    Catalog::GetEntry<CopyFunctionCatalogEntry>(context, INVALID_CATALOG, DEFAULT_SCHEMA, format).function;
+	// index all files of the format below the directory
+	auto pattern = fs.JoinPath(fs.JoinPath(directory, "**"), "*." + copy_function.extension);
+	auto files = fs.GlobFiles(pattern, context, FileGlobOptions::ALLOW_EMPTY);
+	MultiFileIndex::IndexFiles(context, directory, copy_function.copy_from_function, files);
+}
+
 void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 	RegisterEnableProfiling(set);
 
@@ -160,6 +180,11 @@ void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(PragmaFunction::PragmaStatement("enable_checkpoint_on_shutdown", PragmaEnableCheckpointOnShutdown));
 	set.AddFunction(
 	    PragmaFunction::PragmaStatement("disable_checkpoint_on_shutdown", PragmaDisableCheckpointOnShutdown));
+
+	auto create_file_index =
+	    PragmaFunction::PragmaCall("create_file_index", PragmaCreateFileIndex, {LogicalType::VARCHAR});
+	create_file_index.named_parameters["format"] = LogicalType::VARCHAR;
+	set.AddFunction(create_file_index);
 }
 
 } // namespace duckdb
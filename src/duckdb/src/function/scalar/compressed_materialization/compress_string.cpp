@@ -1,8 +1,11 @@
 #include "duckdb/common/bswap.hpp"
+#include "duckdb/common/numeric_utils.hpp"
 #include "duckdb/function/scalar/compressed_materialization_functions.hpp"
 #include "duckdb/function/scalar/compressed_materialization_utils.hpp"
+#include "duckdb/main/client_context.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 
 namespace duckdb {
 
@@ -231,6 +234,124 @@ ScalarFunction CMStringDecompressFun::GetFunction(const LogicalType &input_type)
 	return result;
 }
 
+CMStringDictionaryState::CMStringDictionaryState() : heap(make_buffer<VectorStringBuffer>()) {
+}
+
+shared_ptr<CMStringDictionaryState> CMStringDictionary::GetState(ClientContext &context) {
+	const auto current_query = context.transaction.GetActiveQuery();
+	lock_guard<mutex> guard(lock);
+	if (!state || query_id != current_query) {
+		// the previous execution is done with its state: vectors that reference its strings keep the heap alive
+		state = make_shared_ptr<CMStringDictionaryState>();
+		query_id = current_query;
+	}
+	return state;
+}
+
+CMStringDictionaryData::CMStringDictionaryData(shared_ptr<CMStringDictionary> dictionary_p)
+    : dictionary(std::move(dictionary_p)) {
+}
+
+unique_ptr<FunctionData> CMStringDictionaryData::Copy() const {
+	return make_uniq<CMStringDictionaryData>(dictionary);
+}
+
+bool CMStringDictionaryData::Equals(const FunctionData &other_p) const {
+	auto &other = other_p.Cast<CMStringDictionaryData>();
+	return dictionary.get() == other.dictionary.get();
+}
+
+struct StringDictionaryCompressLocalState : public FunctionLocalState {
+public:
+	explicit StringDictionaryCompressLocalState(shared_ptr<CMStringDictionaryState> dictionary_p)
+	    : dictionary(std::move(dictionary_p)) {
+	}
+
+	static unique_ptr<FunctionLocalState> Init(ExpressionState &state, const BoundFunctionExpression &expr,
+	                                           FunctionData *bind_data) {
+		auto &dictionary = *bind_data->Cast<CMStringDictionaryData>().dictionary;
+		return make_uniq<StringDictionaryCompressLocalState>(dictionary.GetState(state.GetContext()));
+	}
+
+public:
+	shared_ptr<CMStringDictionaryState> dictionary;
+	//! The codes of the strings that were compressed by this thread, so the dictionary is only locked for new strings
+	string_map_t<uint32_t> codes;
+};
+
+static void StringDictionaryCompressFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &local_state = ExecuteFunctionState::GetFunctionState(state)->Cast<StringDictionaryCompressLocalState>();
+	auto &dictionary = *local_state.dictionary;
+	auto &codes = local_state.codes;
+	UnaryExecutor::Execute<string_t, uint32_t>(args.data[0], result, args.size(), [&](const string_t &input) {
+		auto entry = codes.find(input);
+		if (entry != codes.end()) {
+			return entry->second;
+		}
+		lock_guard<mutex> guard(dictionary.lock);
+		auto dictionary_entry = dictionary.codes.find(input);
+		if (dictionary_entry == dictionary.codes.end()) {
+			const auto code = NumericCast<uint32_t>(dictionary.strings.size());
+			const auto str = dictionary.heap->AddString(input);
+			dictionary.strings.push_back(str);
+			dictionary_entry = dictionary.codes.emplace(str, code).first;
+		}
+		codes.emplace(dictionary_entry->first, dictionary_entry->second);
+		return dictionary_entry->second;
+	});
+}
+
+struct StringDictionaryDecompressLocalState : public FunctionLocalState {
+public:
+	explicit StringDictionaryDecompressLocalState(shared_ptr<CMStringDictionaryState> dictionary_p)
+	    : dictionary(std::move(dictionary_p)) {
+	}
+
+	static unique_ptr<FunctionLocalState> Init(ExpressionState &state, const BoundFunctionExpression &expr,
+	                                           FunctionData *bind_data) {
+		auto &dictionary = *bind_data->Cast<CMStringDictionaryData>().dictionary;
+		return make_uniq<StringDictionaryDecompressLocalState>(dictionary.GetState(state.GetContext()));
+	}
+
+public:
+	shared_ptr<CMStringDictionaryState> dictionary;
+};
+
+static void StringDictionaryDecompressFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	// Decompression starts once the materializing operator has consumed all of its input: no strings are added to the
+	// dictionary anymore, so it can be read without locking
+	auto &local_state = ExecuteFunctionState::GetFunctionState(state)->Cast<StringDictionaryDecompressLocalState>();
+	auto &dictionary = *local_state.dictionary;
+	const auto &strings = dictionary.strings;
+	UnaryExecutor::Execute<uint32_t, string_t>(args.data[0], result, args.size(), [&](const uint32_t &input) {
+		D_ASSERT(input < strings.size());
+		return strings[input];
+	});
+	StringVector::AddBuffer(result, dictionary.heap);
+}
+
+static void CMStringDictionarySerialize(Serializer &serializer, const optional_ptr<FunctionData> bind_data,
+                                        const ScalarFunction &function) {
+	// The dictionary is filled during execution, and shared by the compress and decompress functions
+	throw NotImplementedException("Dictionary-encoded compressed materialization cannot be serialized");
+}
+
+ScalarFunction CMStringDictionaryCompressFun::GetFunction() {
+	ScalarFunction result("__internal_compress_string_dictionary", {LogicalType::VARCHAR}, LogicalType::UINTEGER,
+	                      StringDictionaryCompressFunction, CMUtils::Bind, nullptr, nullptr,
+	                      StringDictionaryCompressLocalState::Init);
+	result.serialize = CMStringDictionarySerialize;
+	return result;
+}
+
+ScalarFunction CMStringDictionaryDecompressFun::GetFunction() {
+	ScalarFunction result("__internal_decompress_string_dictionary", {LogicalType::UINTEGER}, LogicalType::VARCHAR,
+	                      StringDictionaryDecompressFunction, CMUtils::Bind, nullptr, nullptr,
+	                      StringDictionaryDecompressLocalState::Init);
+	result.serialize = CMStringDictionarySerialize;
+	return result;
+}
+
 static ScalarFunctionSet GetStringDecompressFunctionSet() {
 	ScalarFunctionSet set(StringDecompressFunctionName());
 	for (const auto &input_type : CMUtils::StringTypes()) {
@@ -0,0 +1,59 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/plan_cache.hpp"
+
+namespace duckdb {
+
+struct DuckDBPlanCacheData : public GlobalTableFunctionState {
+	DuckDBPlanCacheData() : offset(0) {
+	}
+
+	vector<PlanCacheEntryInformation> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBPlanCacheBind(ClientContext &context, TableFunctionBindInput &input,
+                                                    vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("query");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBPlanCacheInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBPlanCacheData>();
+
+	result->entries = PlanCache::Get(context).GetEntries();
+	return std::move(result);
+}
+
+void DuckDBPlanCacheFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBPlanCacheData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// query, VARCHAR
+		output.SetValue(col++, count, Value(entry.query));
+		// hits, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.hits)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBPlanCacheFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(
+	    TableFunction("duckdb_plan_cache", {}, DuckDBPlanCacheFunction, DuckDBPlanCacheBind, DuckDBPlanCacheInit));
+}
+
+} // namespace duckdb
@@ -10,7 +10,9 @@
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/optimizer/matcher/expression_matcher.hpp"
+#include "duckdb/planner/bound_result_modifier.hpp"
 #include "duckdb/planner/expression/bound_between_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -386,6 +388,112 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 	});
 }
 
+static idx_t CountVisibleRows(ClientContext &context, DuckTableEntry &table, unsafe_vector<row_t> &row_ids) {
+	auto &transaction = DuckTransaction::Get(context, table.catalog);
+	auto &storage = table.GetStorage();
+
+	vector<StorageIndex> column_ids {StorageIndex(COLUMN_IDENTIFIER_ROW_ID)};
+	DataChunk chunk;
+	chunk.Initialize(context, {LogicalType::ROW_TYPE});
+	ColumnFetchState fetch_state;
+
+	idx_t visible_count = 0;
+	for (idx_t offset = 0; offset < row_ids.size(); offset += STANDARD_VECTOR_SIZE) {
+		auto fetch_count = MinValue<idx_t>(row_ids.size() - offset, STANDARD_VECTOR_SIZE);
+		Vector row_id_vector(LogicalType::ROW_TYPE, data_ptr_cast(&row_ids[offset]));
+		chunk.Reset();
+		storage.Fetch(transaction, chunk, column_ids, row_id_vector, fetch_count, fetch_state);
+		visible_count += chunk.size();
+	}
+	return visible_count;
+}
+
+bool TableScanFunction::PushdownTopN(ClientContext &context, LogicalGet &get, const BoundOrderByNode &order,
+                                     idx_t count) {
+	if (get.function.name != "seq_scan" || !get.bind_data) {
+		return false;
+	}
+	auto &bind_data = get.bind_data->Cast<TableScanBindData>();
+	auto &table = bind_data.table;
+	auto &storage = table.GetStorage();
+
+	auto &config = ClientConfig::GetConfig(context);
+	if (!config.enable_optimizer || bind_data.is_index_scan || bind_data.is_create_index) {
+		return false;
+	}
+	if (!get.table_filters.filters.empty() || !get.projection_ids.empty()) {
+		// the index scan neither applies table filters nor supports filter_prune
+		return false;
+	}
+	// the ART stores its keys in ascending order and does not contain NULL values
+	if (order.type != OrderType::ASCENDING || order.null_order != OrderByNullType::NULLS_LAST) {
+		return false;
+	}
+	if (order.expression->type != ExpressionType::BOUND_COLUMN_REF) {
+		return false;
+	}
+	auto &order_colref = order.expression->Cast<BoundColumnRefExpression>();
+	if (order_colref.binding.table_index != get.table_index || order_colref.depth != 0) {
+		return false;
+	}
+
+	auto &db_config = DBConfig::GetConfig(context);
+	auto max_count = db_config.GetSetting<IndexScanMaxCountSetting>(context);
+	if (count == 0 || count > max_count) {
+		return false;
+	}
+
+	// find an ART over exactly the ORDER BY column, and collect its leading row ids in key order
+	// we keep doubling the number of collected row ids until enough of them are visible to this transaction
+	unsafe_vector<row_t> row_ids;
+	auto scan_count = count;
+	while (true) {
+		bool found_index = false;
+		bool scanned_all = false;
+		{
+			auto checkpoint_lock = storage.GetSharedCheckpointLock();
+			auto &info = storage.GetDataTableInfo();
+			info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art_index) {
+				if (art_index.unbound_expressions.size() > 1) {
+					return false;
+				}
+				auto index_expression = art_index.unbound_expressions[0]->Copy();
+				if (index_expression->type != ExpressionType::BOUND_COLUMN_REF) {
+					return false;
+				}
+				bool rewrite_possible = true;
+				RewriteIndexExpression(art_index, get, *index_expression, rewrite_possible);
+				auto &index_colref = index_expression->Cast<BoundColumnRefExpression>();
+				if (!rewrite_possible || index_colref.binding != order_colref.binding) {
+					return false;
+				}
+				found_index = true;
+				row_ids.clear();
+				scanned_all = art_index.ScanOrdered(scan_count, row_ids);
+				return true;
+			});
+		}
+		if (!found_index) {
+			return false;
+		}
+
+		// Fetch takes the checkpoint lock itself, so we count the visible rows outside of the lock.
+		if (CountVisibleRows(context, table, row_ids) >= count) {
+			break;
+		}
+		if (scanned_all || scan_count >= max_count) {
+			// the remaining rows are NULL, or too many of the indexed rows are not visible to us
+			return false;
+		}
+		scan_count = MinValue<idx_t>(scan_count * 2, max_count);
+	}
+
+	bind_data.row_ids = std::move(row_ids);
+	bind_data.is_index_scan = true;
+	get.function = TableScanFunction::GetIndexScanFunction();
+	return true;
+}
+
 string TableScanToString(const FunctionData *bind_data_p) {
 	auto &bind_data = bind_data_p->Cast<TableScanBindData>();
 	string result = bind_data.table.name;
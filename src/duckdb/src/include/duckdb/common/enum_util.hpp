@@ -360,6 +360,8 @@ enum class VerificationType : uint8_t;
 
 enum class VerifyExistenceType : uint8_t;
 
+enum class WALCommitMode : uint8_t;
+
 enum class WALType : uint8_t;
 
 enum class WindowAggregationMode : uint32_t;
@@ -861,6 +863,9 @@ const char* EnumUtil::ToChars<VerificationType>(VerificationType value);
 template<>
 const char* EnumUtil::ToChars<VerifyExistenceType>(VerifyExistenceType value);
 
+template<>
+const char* EnumUtil::ToChars<WALCommitMode>(WALCommitMode value);
+
 template<>
 const char* EnumUtil::ToChars<WALType>(WALType value);
 
@@ -1366,6 +1371,9 @@ VerificationType EnumUtil::FromString<VerificationType>(const char *value);
 template<>
 VerifyExistenceType EnumUtil::FromString<VerifyExistenceType>(const char *value);
 
+template<>
+WALCommitMode EnumUtil::FromString<WALCommitMode>(const char *value);
+
 template<>
 WALType EnumUtil::FromString<WALType>(const char *value);
 
@@ -26,7 +26,10 @@ enum class CompressionType : uint8_t {
 	COMPRESSION_PATAS = 9,
 	COMPRESSION_ALP = 10,
 	COMPRESSION_ALPRD = 11,
-	COMPRESSION_COUNT // This has to stay the last entry of the type!
+	COMPRESSION_COUNT, // This has to stay the last entry of the contiguous types!
+	// Types that are not part of the upstream storage format use values from 128 on,
+	// so that they cannot collide with the types that upstream DuckDB versions assign
+	COMPRESSION_ZSTD = 128
 };
 
 bool CompressionTypeIsDeprecated(CompressionType compression_type);
@@ -28,6 +28,7 @@ enum class PhysicalOperatorType : uint8_t {
 	HASH_GROUP_BY,
 	PERFECT_HASH_GROUP_BY,
 	PARTITIONED_AGGREGATE,
+	STREAMING_AGGREGATE,
 	FILTER,
 	PROJECTION,
 	COPY_TO_FILE,
@@ -63,6 +64,7 @@ enum class PhysicalOperatorType : uint8_t {
 	RIGHT_DELIM_JOIN,
 	POSITIONAL_JOIN,
 	ASOF_JOIN,
+	INDEX_JOIN,
 	// -----------------------------
 	// SetOps
 	// -----------------------------
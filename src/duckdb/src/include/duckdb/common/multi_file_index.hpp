@@ -0,0 +1,85 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/multi_file_index.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/case_insensitive_map.hpp"
+#include "duckdb/common/map.hpp"
+#include "duckdb/storage/object_cache.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+class Expression;
+class FileHandle;
+class FileSystem;
+struct MultiFilePushdownInfo;
+class TableFunction;
+
+//! The MultiFileIndex is a sidecar file with the column statistics of the files below a directory. Multi-file scans
+//! use it to prune files on their column statistics before any of the files are opened.
+//! The index is created by COPY ... (FILE_INDEX) or PRAGMA create_file_index, and is only consulted when
+//! enable_file_index is set. A file is only pruned if its size and modification time still match the index, which
+//! opens every pruned file - unless file_index_check_changes is disabled.
+class MultiFileIndex : public ObjectCacheEntry {
+public:
+	//! The name of the index file in the directory that it indexes
+	static constexpr const char *INDEX_FILE_NAME = "_duckdb_file_index";
+	static constexpr idx_t INDEX_VERSION = 1;
+
+public:
+	//! Whether multi-file scans consult file indexes
+	static bool Enabled(ClientContext &context);
+	//! Load the index of a directory (or nullptr if the directory has no index)
+	static shared_ptr<MultiFileIndex> TryLoad(ClientContext &context, const string &directory);
+	//! Add the given files below the directory to its index, using the statistics of the reader of their format
+	static void IndexFiles(ClientContext &context, const string &directory, TableFunction &reader,
+	                       const vector<string> &files);
+	//! Remove the files from the list that the filters exclude according to the indexes of the scanned paths
+	static void ApplyFiltersToFileList(ClientContext &context, const vector<string> &paths, vector<string> &files,
+	                                   const vector<unique_ptr<Expression>> &filters, MultiFilePushdownInfo &info);
+	//! The directory whose index covers the files of a path (or glob)
+	static string GetIndexDirectory(const string &path);
+
+	static string ObjectType() {
+		return "multi_file_index";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+	optional_idx GetEstimatedCacheMemory() const override {
+		return index_size;
+	}
+
+	//! Returns the statistics of a column of a file (or nullptr if they are not known)
+	optional_ptr<BaseStatistics> GetStatistics(const string &relative_path, const string &column_name);
+	//! Whether the file is still the one that was indexed, i.e., its size and modification time are unchanged
+	bool IsUnchanged(FileSystem &fs, const string &path, const string &relative_path) const;
+
+private:
+	struct IndexedFile {
+		idx_t file_size = 0;
+		time_t last_modified = 0;
+		case_insensitive_map_t<BaseStatistics> columns;
+	};
+
+private:
+	void AddFile(ClientContext &context, TableFunction &reader, const string &path, const string &relative_path);
+	void Write(ClientContext &context, const string &directory) const;
+	void Read(FileSystem &fs, unique_ptr<FileHandle> handle);
+
+private:
+	//! The metadata and column statistics per file, the paths of the files are relative to the directory of the index
+	map<string, IndexedFile> files;
+	//! The modification time of the index file that was read
+	time_t last_modified = 0;
+	//! The size of the index file that was read
+	idx_t index_size = 0;
+};
+
+} // namespace duckdb
@@ -22,6 +22,8 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	//! Keys containing strings are radix partitioned until the partitions fit in cache (in bytes), then pdqsorted
+	static constexpr idx_t STRING_RADIX_PARTITION_SIZE = 262144;
 };
 
 struct SortLayout {
@@ -42,7 +42,8 @@ public:
 	};
 
 public:
-	ColumnDataConsumer(ColumnDataCollection &collection, vector<column_t> column_ids);
+	//! If consume is false, read blocks are kept so that the collection can be scanned again
+	ColumnDataConsumer(ColumnDataCollection &collection, vector<column_t> column_ids, bool consume = true);
 
 	idx_t Count() const {
 		return collection.Count();
@@ -71,6 +72,8 @@ private:
 	ColumnDataCollection &collection;
 	//! The column ids to scan
 	vector<column_t> column_ids;
+	//! Whether read blocks are deleted
+	bool consume;
 	//! The number of chunk references
 	idx_t chunk_count;
 	//! The chunks (in order) to be scanned
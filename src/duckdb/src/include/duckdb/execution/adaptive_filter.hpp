@@ -11,14 +11,19 @@
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/chrono.hpp"
-#include "duckdb/common/random_engine.hpp"
 
 namespace duckdb {
+class BaseStatistics;
 
 struct AdaptiveFilterState {
+	//! Whether the predicates are measured for this chunk
+	bool measure = false;
 	time_point<high_resolution_clock> start_time;
 };
 
+//! The AdaptiveFilter orders the predicates of a conjunction by their rank: for AND, the cost per tuple divided by the
+//! fraction of tuples it removes; for OR, the cost per tuple divided by the fraction of tuples it passes. Cost and
+//! selectivity are seeded from the predicate types (and statistics), then measured in periodic sampling windows.
 class AdaptiveFilter {
 public:
 	explicit AdaptiveFilter(const Expression &expr);
@@ -27,25 +32,65 @@ public:
 	vector<idx_t> permutation;
 
 public:
-	void AdaptRuntimeStatistics(double duration);
-
 	AdaptiveFilterState BeginFilter() const;
 	void EndFilter(AdaptiveFilterState state);
 
+	//! Start measuring a single predicate
+	void BeginPredicate(AdaptiveFilterState &state) const {
+		if (state.measure) {
+			state.start_time = high_resolution_clock::now();
+		}
+	}
+	//! Record the runtime and the selectivity of a single predicate
+	void EndPredicate(AdaptiveFilterState &state, idx_t predicate_idx, idx_t input_count, idx_t output_count);
+
+	//! Whether the table filter estimates still have to be seeded from column statistics
+	bool RequiresStatistics() const {
+		return !seeded;
+	}
+	//! Seed the estimates of the table filter from the statistics of its column
+	void SeedStatistics(idx_t predicate_idx, const TableFilter &filter, const BaseStatistics &stats);
+	//! Finish seeding the estimates from statistics
+	void FinishSeeding();
+
+private:
+	struct PredicateStatistics {
+		//! The estimated cost per input tuple
+		double cost = 1.0;
+		//! The estimated fraction of input tuples that pass the predicate
+		double selectivity = 0.5;
+		//! Whether cost and selectivity have been measured (or are still the seeded estimates)
+		bool measured = false;
+		//! The seeded cost estimate of a measured predicate, used to scale the estimates of unmeasured predicates
+		double seed_cost = 0;
+		//! The measurements of the current sampling window
+		double window_runtime = 0;
+		idx_t window_input = 0;
+		idx_t window_output = 0;
+	};
+
+	bool CanPermute() const {
+		return permutation.size() > 1 && !disable_permutations;
+	}
+	double GetRank(const PredicateStatistics &predicate, double cost) const;
+	double GetExpectedCost(const vector<idx_t> &order, const vector<double> &costs) const;
+	void UpdateStatistics();
+	void Reorder();
+
 private:
 	bool disable_permutations = false;
+	//! Whether this is an OR (instead of an AND) of the predicates
+	bool is_or = false;
+	//! Whether the estimates have been seeded from statistics
+	bool seeded = true;
 
-	//! used for adaptive expression reordering
+	vector<PredicateStatistics> predicates;
+	//! The chunk count of the current window
 	idx_t iteration_count = 0;
-	idx_t swap_idx = 0;
-	idx_t right_random_border = 0;
-	idx_t observe_interval = 0;
-	idx_t execute_interval = 0;
-	double runtime_sum = 0;
-	double prev_mean = 0;
-	bool observe = false;
-	bool warmup = false;
-	vector<idx_t> swap_likeliness;
-	RandomEngine generator;
+	//! The amount of chunks measured per sampling window
+	idx_t observe_interval;
+	//! The amount of chunks executed without measuring between sampling windows
+	idx_t execute_interval;
+	bool observe = true;
 };
 } // namespace duckdb
@@ -0,0 +1,31 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/adaptive_join_order.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+class Pipeline;
+
+//! The AdaptiveJoinOrder re-orders the hash join probes of a pipeline before it starts. At that point, the build sides
+//! of the joins have been materialized: if their sizes are far off the estimates the join order was based on, the
+//! chains of hash join probes in the pipeline are re-ordered using the actual sizes.
+class AdaptiveJoinOrder {
+public:
+	//! The factor by which the size of a build side has to differ from its estimate to re-order the probes
+	static constexpr double MISESTIMATE_THRESHOLD = 10;
+	//! The fraction of the expected cost of the probes that re-ordering has to save
+	static constexpr double MINIMUM_IMPROVEMENT = 0.2;
+
+public:
+	//! Re-order the chains of hash join probes of a pipeline whose build sides have been finalized
+	static void ReorderProbes(Pipeline &pipeline);
+};
+
+} // namespace duckdb
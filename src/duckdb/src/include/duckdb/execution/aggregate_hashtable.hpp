@@ -44,6 +44,8 @@ public:
 public:
 	//! The hash table load factor, when a resize is triggered
 	constexpr static double LOAD_FACTOR = 1.5;
+	//! Capacity of the (direct-mapped) table of hot groups that are still aggregated in place when skipping lookups
+	constexpr static idx_t HOT_GROUP_CAPACITY = 1024;
 
 	//! Get the layout of this HT
 	const TupleDataLayout &GetLayout() const;
@@ -88,6 +90,14 @@ public:
 	void ResetCount();
 	//! Set the radix bits for this HT
 	void SetRadixBits(idx_t radix_bits);
+	//! Whether groups are appended without looking them up in the pointer table
+	bool SkipLookups() const;
+	//! Append every row as a new group (true) or look the groups up again (false). While skipping lookups, rows of
+	//! the hot groups are still aggregated in place
+	void SetSkipLookups(bool skip_lookups);
+	//! Start (true) or stop (false) recording the groups that are found again during lookups as hot groups.
+	//! Starting clears the previously recorded hot groups
+	void TrackHotGroups(bool track);
 	//! Initializes the PartitionedTupleData
 	void InitializePartitionedData();
 
@@ -129,6 +139,14 @@ private:
 
 	//! The number of groups in the HT
 	idx_t count;
+	//! Whether rows are appended without probing (the groups are combined later)
+	bool skip_lookups;
+	//! Whether groups that are found again during lookups are recorded in hot_groups
+	bool track_hot_groups;
+	//! Groups that repeated while tracking, indexed by hash - only valid while the data stays pinned
+	unsafe_unique_array<ht_entry_t> hot_groups;
+	//! Whether hot_groups contains any entries
+	bool has_hot_groups;
 	//! The capacity of the HT. This can be increased using GroupedAggregateHashTable::Resize
 	idx_t capacity;
 	//! The hash map (pointer table) of the HT: allocated data and pointer into it
@@ -152,6 +170,11 @@ private:
 
 	//! Apply bitmask to get the entry in the HT
 	inline idx_t ApplyBitMask(hash_t hash) const;
+	//! Forgets the recorded hot groups (their rows are about to be unpinned or moved)
+	void ClearHotGroups();
+	//! Appends the groups while skipping lookups: only the hot groups are looked up
+	idx_t AppendSkippingLookups(DataChunk &groups, const hash_t *hashes, Vector &addresses_v,
+	                            SelectionVector &new_groups_out);
 
 	//! Does the actual group matching / creation
 	idx_t FindOrCreateGroupsInternal(DataChunk &groups, Vector &group_hashes, Vector &addresses,
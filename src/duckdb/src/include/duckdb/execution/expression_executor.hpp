@@ -104,6 +104,12 @@ protected:
 	                                                   ExpressionExecutorState &state);
 	static unique_ptr<ExpressionState> InitializeState(const BoundParameterExpression &expr,
 	                                                   ExpressionExecutorState &state);
+	//! Initializes a state that evaluates the expression and an arithmetic child in a single pass (nullptr if the
+	//! expression cannot be fused)
+	static unique_ptr<ExpressionState> InitializeFusedState(const BoundFunctionExpression &expr,
+	                                                        ExpressionExecutorState &state);
+	static unique_ptr<ExpressionState> InitializeFusedState(const BoundComparisonExpression &expr,
+	                                                        ExpressionExecutorState &state);
 
 	void Execute(const Expression &expr, ExpressionState *state, const SelectionVector *sel, idx_t count,
 	             Vector &result);
@@ -129,6 +135,7 @@ protected:
 	             Vector &result);
 	void Execute(const BoundReferenceExpression &expr, ExpressionState *state, const SelectionVector *sel, idx_t count,
 	             Vector &result);
+	void ExecuteFused(ExpressionState *state, const SelectionVector *sel, idx_t count, Vector &result);
 
 	//! Execute the (boolean-returning) expression and generate a selection vector with all entries that are "true" in
 	//! the result
@@ -143,6 +150,8 @@ protected:
 	             SelectionVector *true_sel, SelectionVector *false_sel);
 	idx_t Select(const BoundConjunctionExpression &expr, ExpressionState *state, const SelectionVector *sel,
 	             idx_t count, SelectionVector *true_sel, SelectionVector *false_sel);
+	idx_t SelectFused(ExpressionState *state, const SelectionVector *sel, idx_t count, SelectionVector *true_sel,
+	                  SelectionVector *false_sel);
 
 	//! Verify that the output of a step in the ExpressionExecutor is correct
 	void Verify(const Expression &expr, Vector &result, idx_t count);
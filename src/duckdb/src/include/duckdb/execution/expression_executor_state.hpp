@@ -29,6 +29,8 @@ struct ExpressionState {
 	vector<LogicalType> types;
 	DataChunk intermediate_chunk;
 	vector<bool> initialize;
+	//! Whether this is a FusedExpressionState
+	bool fused = false;
 
 public:
 	void AddChild(Expression &child_expr);
@@ -64,6 +66,23 @@ public:
 	}
 };
 
+typedef void (*fused_execute_t)(Vector &a, Vector &b, Vector &c, Vector &result, idx_t count);
+typedef idx_t (*fused_select_t)(Vector &a, Vector &b, Vector &c, const SelectionVector *sel, idx_t count,
+                                SelectionVector *true_sel, SelectionVector *false_sel);
+typedef void (*fused_check_t)(Vector &a, Vector &b, Vector &c, idx_t count);
+
+//! State of an arithmetic or comparison expression that is fused with an arithmetic child: the three inputs of the
+//! two expressions are the child states, and a single kernel computes the result without materializing the child
+struct FusedExpressionState : public ExpressionState {
+	FusedExpressionState(const Expression &expr, ExpressionExecutorState &root);
+
+	fused_execute_t execute = nullptr;
+	//! Only set for comparisons
+	fused_select_t select = nullptr;
+	//! Raises the errors of the nested expression in rows that the kernels skip (only set if it can raise errors)
+	fused_check_t check = nullptr;
+};
+
 struct ExpressionExecutorState {
 	ExpressionExecutorState();
 
@@ -73,6 +73,12 @@ public:
 	//! Perform a lookup on the ART, fetching up to max_count row IDs.
 	//! If all row IDs were fetched, it return true, else false.
 	bool Scan(IndexScanState &state, idx_t max_count, unsafe_vector<row_t> &row_ids);
+	//! Perform a full scan of the ART in key order, fetching up to max_count row IDs.
+	//! If all row IDs were fetched, it return true, else false.
+	bool ScanOrdered(idx_t max_count, unsafe_vector<row_t> &row_ids);
+	//! Look up the row IDs matching each of the first count keys, and write them to row_ids[i].
+	//! Empty (NULL) keys do not match any row.
+	void LookupRowIds(unsafe_vector<ARTKey> &keys, idx_t count, vector<unsafe_vector<row_t>> &row_ids);
 
 	//! Append a chunk by first executing the ART's expressions.
 	ErrorData Append(IndexLock &lock, DataChunk &input, Vector &row_ids) override;
@@ -62,6 +62,9 @@ public:
 	//! only compare salts with the ht entries if the capacity is larger than 8192 so
 	//! that it does not fit into the CPU cache
 	static constexpr const idx_t USE_SALT_THRESHOLD = 8192;
+	//! only prefetch the ht entries and rows while probing if the capacity is larger than 262144 (2MB of entries),
+	//! for smaller tables the entries are likely to be cached already and the prefetches are pure overhead
+	static constexpr const idx_t USE_PREFETCH_THRESHOLD = 262144;
 
 	//! Scan structure that can be used to resume scans, as a single probe can
 	//! return 1024*N values (where N is the size of the HT). This is
@@ -176,6 +179,8 @@ public:
 	//! Probe the HT with the given input chunk, resulting in the given result
 	void Probe(ScanStructure &scan_structure, DataChunk &keys, TupleDataChunkState &key_state, ProbeState &probe_state,
 	           optional_ptr<Vector> precomputed_hashes = nullptr);
+	//! Whether probes prefetch the entries and rows they are about to compare
+	bool UsePrefetch() const;
 	//! Scan the HT to construct the full outer join result
 	void ScanFullOuter(JoinHTScanState &state, Vector &addresses, DataChunk &result) const;
 
@@ -365,6 +370,8 @@ public:
 
 		//! The active probe data
 		unique_ptr<ColumnDataCollection> global_spill_collection;
+		//! Whether the active probe data has to be probed again against the next piece of the build partition
+		bool probe_again = false;
 	};
 
 	idx_t GetRadixBits() const {
@@ -396,7 +403,7 @@ public:
 	                   idx_t &max_partition_size, idx_t &max_partition_count) const;
 	//! Get the remaining size of the unbuilt partitions
 	idx_t GetRemainingSize() const;
-	//! Sets number of radix bits according to the max ht size
+	//! Sets number of radix bits according to the max ht size (repartitioning the data that was already merged)
 	void SetRepartitionRadixBits(const idx_t max_ht_size, const idx_t max_partition_size,
 	                             const idx_t max_partition_count);
 	//! Partition this HT
@@ -406,6 +413,14 @@ public:
 	void Reset();
 	//! Build HT for the next partitioned probe round
 	bool PrepareExternalFinalize(const idx_t max_ht_size);
+	//! Whether a partition that does not fit in memory can be built and probed in several pieces. Every piece is
+	//! probed with all of the partition's probe rows, so this only works if probe rows are not emitted based on
+	//! whether they found a match
+	bool CanSplitPartitions() const;
+	//! Whether the current probe round is followed by another piece of the same partition
+	bool HasRemainingPartitionPieces() const {
+		return !partition_pieces.empty();
+	}
 	//! Probe whatever we can, sink the rest into a thread-local HT
 	void ProbeAndSpill(ScanStructure &scan_structure, DataChunk &keys, TupleDataChunkState &key_state,
 	                   ProbeState &probe_state, DataChunk &payload, ProbeSpill &probe_spill,
@@ -418,6 +433,12 @@ private:
 	//! First and last partition of the current probe round
 	idx_t partition_start;
 	idx_t partition_end;
+	//! The remaining pieces of a partition that was too large to be built at once (in reverse order)
+	vector<unique_ptr<TupleDataCollection>> partition_pieces;
+
+private:
+	//! Splits a partition into pieces that each fit in max_ht_size
+	void SplitPartition(TupleDataCollection &partition, const idx_t max_ht_size);
 };
 
 } // namespace duckdb
@@ -40,7 +40,8 @@ public:
 public:
 	bool CanDoPerfectHashJoin();
 
-	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context);
+	//! Get the probe state of the join operator that probes the perfect hash table
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context, const PhysicalHashJoin &probe_join);
 	OperatorResultType ProbePerfectHashTable(ExecutionContext &context, DataChunk &input, DataChunk &lhs_output_columns,
 	                                         DataChunk &chunk, OperatorState &state);
 	bool BuildPerfectHashTable(LogicalType &type);
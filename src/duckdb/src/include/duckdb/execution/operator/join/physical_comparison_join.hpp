@@ -22,6 +22,8 @@ class PhysicalComparisonJoin : public PhysicalJoin {
 public:
 	PhysicalComparisonJoin(LogicalOperator &op, PhysicalOperatorType type, vector<JoinCondition> cond,
 	                       JoinType join_type, idx_t estimated_cardinality);
+	PhysicalComparisonJoin(PhysicalOperatorType type, vector<LogicalType> types, vector<JoinCondition> cond,
+	                       JoinType join_type, idx_t estimated_cardinality);
 
 	vector<JoinCondition> conditions;
 	//! Scans where we should push generated filters into (if any)
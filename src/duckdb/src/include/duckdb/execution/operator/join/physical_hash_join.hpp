@@ -27,6 +27,16 @@ public:
 		vector<LogicalType> col_types;
 	};
 
+	//! The estimates of probing a hash join whose build side has been finalized
+	struct ProbeEstimate {
+		//! The estimated amount of output tuples per probe tuple, corrected with the actual size of the build side
+		double selectivity;
+		//! The relative cost of probing a tuple
+		double cost;
+		//! The factor by which the actual size of the build side differs from its estimate
+		double misestimate;
+	};
+
 public:
 	PhysicalHashJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left, unique_ptr<PhysicalOperator> right,
 	                 vector<JoinCondition> cond, JoinType join_type, const vector<idx_t> &left_projection_map,
@@ -36,6 +46,9 @@ public:
 	PhysicalHashJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left, unique_ptr<PhysicalOperator> right,
 	                 vector<JoinCondition> cond, JoinType join_type, idx_t estimated_cardinality,
 	                 PerfectHashJoinStats join_state);
+	//! Create a copy of a join that probes the hash table of the join with input chunks of a different layout
+	PhysicalHashJoin(const PhysicalHashJoin &build_join, vector<LogicalType> types, vector<JoinCondition> cond,
+	                 JoinProjectionColumns lhs_output_columns);
 
 	//! Initialize HT for this operator
 	unique_ptr<JoinHashTable> InitializeHashTable(ClientContext &context) const;
@@ -54,10 +67,21 @@ public:
 	vector<LogicalType> delim_types;
 	//! Used in perfect hash join
 	PerfectHashJoinStats perfect_join_statistics;
+	//! If this is a copy of a join with a different probe side: the join that built the hash table
+	optional_ptr<const PhysicalHashJoin> build_join;
+	//! Whether the hash table is kept after the probes are done, so that it can be probed again, e.g., in the next
+	//! iteration of a recursive CTE
+	bool keep_hash_table = false;
 
 public:
 	InsertionOrderPreservingMap<string> ParamsToString() const override;
 
+	//! Estimate the probes of this join from its finalized build side. Returns false if the probes of this join cannot
+	//! be re-ordered with the probes of other joins.
+	bool EstimateProbe(ProbeEstimate &result) const;
+	//! Whether the finalized hash table was kept after its probes, and can be probed again
+	bool CanReuseHashTable() const;
+
 public:
 	// Operator Interface
 	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
@@ -0,0 +1,58 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/physical_index_join.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/storage/storage_index.hpp"
+
+namespace duckdb {
+class DuckTableEntry;
+
+//! PhysicalIndexJoin represents an index nested loop join: every key of the (small) probe side is looked up in an ART
+//! index of a base table, and only the matching rows of that table are fetched
+class PhysicalIndexJoin : public CachingPhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::INDEX_JOIN;
+
+public:
+	PhysicalIndexJoin(vector<LogicalType> types, unique_ptr<PhysicalOperator> probe, unique_ptr<Expression> probe_key,
+	                  vector<idx_t> probe_projection_map, DuckTableEntry &table, string index_name,
+	                  vector<StorageIndex> fetch_ids, vector<LogicalType> fetch_types, bool probe_first,
+	                  idx_t estimated_cardinality);
+
+	//! The expression computing the join key from the probe side
+	unique_ptr<Expression> probe_key;
+	//! The probe columns to emit (all columns if empty)
+	vector<idx_t> probe_projection_map;
+	//! The indexed table
+	DuckTableEntry &table;
+	//! The name of the ART index over the join key of the table
+	string index_name;
+	//! The table columns to fetch for the matching rows
+	vector<StorageIndex> fetch_ids;
+	//! The types of the fetched table columns
+	vector<LogicalType> fetch_types;
+	//! Whether the probe columns come before the table columns in the result
+	bool probe_first;
+
+public:
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+
+	bool ParallelOperator() const override {
+		return true;
+	}
+
+	InsertionOrderPreservingMap<string> ParamsToString() const override;
+
+protected:
+	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                                   GlobalOperatorState &gstate, OperatorState &state) const override;
+};
+
+} // namespace duckdb
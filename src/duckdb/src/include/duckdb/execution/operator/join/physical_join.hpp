@@ -20,6 +20,7 @@ public:
 
 public:
 	PhysicalJoin(LogicalOperator &op, PhysicalOperatorType type, JoinType join_type, idx_t estimated_cardinality);
+	PhysicalJoin(PhysicalOperatorType type, vector<LogicalType> types, JoinType join_type, idx_t estimated_cardinality);
 
 	JoinType join_type;
 
@@ -14,6 +14,7 @@
 namespace duckdb {
 
 class RecursiveCTEState;
+class RecursiveCTELocalState;
 
 class PhysicalRecursiveCTE : public PhysicalOperator {
 public:
@@ -44,7 +45,10 @@ public:
 	// Sink interface
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
 
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+
 	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
 
 	bool IsSink() const override {
 		return true;
@@ -62,9 +66,11 @@ public:
 	vector<const_reference<PhysicalOperator>> GetSources() const override;
 
 private:
-	//! Probe Hash Table and eliminate duplicate rows
-	idx_t ProbeHT(DataChunk &chunk, RecursiveCTEState &state) const;
+	//! Probe Hash Table and eliminate duplicate rows, the new rows are appended to the local intermediate table
+	void ProbeHT(DataChunk &chunk, RecursiveCTEState &gstate, RecursiveCTELocalState &lstate) const;
 
+	//! Execute the pipelines of the recursive part again. The hash tables of joins whose build side does not depend
+	//! on the working table are built in the first iteration only.
 	void ExecuteRecursivePipelines(ExecutionContext &context) const;
 };
 
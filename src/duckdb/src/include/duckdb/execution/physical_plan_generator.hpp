@@ -34,6 +34,9 @@ public:
 	unordered_map<idx_t, shared_ptr<ColumnDataCollection>> recursive_cte_tables;
 	//! Materialized CTE ids must be collected.
 	unordered_map<idx_t, vector<const_reference<PhysicalOperator>>> materialized_ctes;
+	//! Whether the plan depends on the state of the transaction that it was created in, and has to be re-planned
+	//! before every execution (e.g., of a prepared statement)
+	bool requires_rebind = false;
 
 public:
 	//! Creates a plan from the logical operator. This involves resolving column bindings and generating physical
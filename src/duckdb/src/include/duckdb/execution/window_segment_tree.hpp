@@ -155,6 +155,33 @@ public:
 	WindowAggregationMode mode;
 };
 
+//! Slides a single aggregate state along monotonic frames: rows entering the frame are added,
+//! rows leaving it are taken out with the aggregate's remove function. MIN/MAX use a monotonic deque instead.
+//! The aggregates of the row ranges built by each thread are kept, so a thread can start
+//! its frames in the middle of a large partition by combining them instead of scanning.
+class WindowSlidingAggregator : public WindowAggregator {
+public:
+	static bool CanAggregate(const BoundWindowExpression &wexpr);
+
+	WindowSlidingAggregator(const BoundWindowExpression &wexpr, const WindowExcludeMode exclude_mode,
+	                        WindowSharedExpressions &shared);
+
+	unique_ptr<WindowAggregatorState> GetGlobalState(ClientContext &context, idx_t group_count,
+	                                                 const ValidityMask &partition_mask) const override;
+	unique_ptr<WindowAggregatorState> GetLocalState(const WindowAggregatorState &gstate) const override;
+	void Sink(WindowAggregatorState &gstate, WindowAggregatorState &lstate, DataChunk &sink_chunk,
+	          DataChunk &coll_chunk, idx_t input_idx, optional_ptr<SelectionVector> filter_sel,
+	          idx_t filtered) override;
+	void Finalize(WindowAggregatorState &gstate, WindowAggregatorState &lstate, CollectionPtr collection,
+	              const FrameStats &stats) override;
+	void Evaluate(const WindowAggregatorState &gsink, WindowAggregatorState &lstate, const DataChunk &bounds,
+	              Vector &result, idx_t count, idx_t row_idx) const override;
+
+public:
+	//! Whether the aggregate is a MIN (-1), a MAX (+1) or removable (0)
+	int8_t extreme;
+};
+
 class WindowDistinctAggregator : public WindowAggregator {
 public:
 	WindowDistinctAggregator(const BoundWindowExpression &wexpr, const WindowExcludeMode exclude_mode_p,
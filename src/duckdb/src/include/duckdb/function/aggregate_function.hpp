@@ -180,6 +180,9 @@ public:
 	aggregate_window_t window;
 	//! The windowed aggregate custom initialization function (may be null)
 	aggregate_wininit_t window_init = nullptr;
+	//! The inverse of the simple update function: removes the inputs from the state (may be null)
+	//! This allows windowed aggregates to slide their frame instead of building a segment tree
+	aggregate_simple_update_t remove = nullptr;
 
 	//! The bind function (may be null)
 	bind_aggregate_function_t bind;
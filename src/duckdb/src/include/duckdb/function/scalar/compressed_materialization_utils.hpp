@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/string_map_set.hpp"
+#include "duckdb/common/types/vector_buffer.hpp"
 #include "duckdb/function/built_in_functions.hpp"
 #include "duckdb/function/function_set.hpp"
 
@@ -42,4 +45,54 @@ struct CMStringDecompressFun {
 	static ScalarFunction GetFunction(const LogicalType &input_type);
 };
 
+//! The strings of a dictionary during one execution of the plan. Strings are assigned codes while they are
+//! compressed, and are decompressed once the operator has materialized all of them
+struct CMStringDictionaryState {
+public:
+	CMStringDictionaryState();
+
+public:
+	mutex lock;
+	//! The heap that holds the strings, referenced by the vectors that decompressed strings are written to
+	buffer_ptr<VectorStringBuffer> heap;
+	//! The code of each string in the dictionary
+	string_map_t<uint32_t> codes;
+	//! The string of each code
+	vector<string_t> strings;
+};
+
+//! The dictionary of a dictionary-encoded string column, which is shared by its compress and decompress functions.
+//! Every execution of the plan (e.g., of a prepared statement) starts with an empty state
+struct CMStringDictionary {
+public:
+	//! Returns the state of the dictionary for the query that is currently executed by the client
+	shared_ptr<CMStringDictionaryState> GetState(ClientContext &context);
+
+private:
+	mutex lock;
+	//! The query that the state belongs to
+	transaction_t query_id = MAXIMUM_QUERY_ID;
+	shared_ptr<CMStringDictionaryState> state;
+};
+
+struct CMStringDictionaryData : public FunctionData {
+public:
+	explicit CMStringDictionaryData(shared_ptr<CMStringDictionary> dictionary);
+
+public:
+	unique_ptr<FunctionData> Copy() const override;
+	bool Equals(const FunctionData &other_p) const override;
+
+public:
+	shared_ptr<CMStringDictionary> dictionary;
+};
+
+struct CMStringDictionaryCompressFun {
+	static ScalarFunction GetFunction();
+};
+
+struct CMStringDictionaryDecompressFun {
+	static ScalarFunction GetFunction();
+};
+
 } // namespace duckdb
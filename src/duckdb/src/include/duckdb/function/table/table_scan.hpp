@@ -15,6 +15,8 @@
 namespace duckdb {
 class DuckTableEntry;
 class TableCatalogEntry;
+class LogicalGet;
+struct BoundOrderByNode;
 
 struct TableScanBindData : public TableFunctionData {
 	explicit TableScanBindData(DuckTableEntry &table) : table(table), is_index_scan(false), is_create_index(false) {
@@ -42,6 +44,9 @@ struct TableScanFunction {
 	static void RegisterFunction(BuiltinFunctions &set);
 	static TableFunction GetFunction();
 	static TableFunction GetIndexScanFunction();
+	//! Try to turn the scan below an ORDER BY ... LIMIT into an index scan over the first rows of a matching ART.
+	//! Returns true if the scan was rewritten.
+	static bool PushdownTopN(ClientContext &context, LogicalGet &get, const BoundOrderByNode &order, idx_t count);
 };
 
 } // namespace duckdb
@@ -97,10 +97,18 @@ struct ClientConfig {
 	idx_t partitioned_write_flush_threshold = idx_t(1) << idx_t(19);
 	//! The amount of rows we can keep open before we close and flush them during a partitioned write
 	idx_t partitioned_write_max_open_files = idx_t(100);
+	//! Whether multi-file scans prune files using the file index of their directory
+	bool enable_file_index = false;
+	//! Whether the file index only prunes files whose size and modification time are unchanged
+	bool file_index_check_changes = true;
+	//! Whether chains of hash join probes are re-ordered when the sizes of their build sides were misestimated
+	bool enable_adaptive_join_order = true;
 	//! The number of rows we need on either table to choose a nested loop join
 	idx_t nested_loop_join_threshold = 5;
 	//! The number of rows we need on either table to choose a merge join over an IE join
 	idx_t merge_join_threshold = 1000;
+	//! The maximum number of rows on the probe side to choose an index nested loop join against an indexed table
+	idx_t index_join_threshold = 10000;
 
 	//! The maximum amount of memory to keep buffered in a streaming query result. Default: 1mb.
 	idx_t streaming_buffer_size = 1000000;
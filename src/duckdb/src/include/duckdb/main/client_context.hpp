@@ -291,6 +291,8 @@ private:
 	shared_ptr<PreparedStatementData>
 	CreatePreparedStatementInternal(ClientContextLock &lock, const string &query, unique_ptr<SQLStatement> statement,
 	                                optional_ptr<case_insensitive_map_t<BoundParameterData>> values);
+	//! Whether plans of this client can be taken from (and put in) the plan cache
+	bool CanCachePlan();
 
 private:
 	//! Lock on using the ClientContext in parallel
@@ -61,6 +61,11 @@ struct ClientData {
 	//! The file search path
 	string file_search_path;
 
+	//! The hash of the settings of this client, used as part of the plan cache key
+	hash_t plan_cache_settings_hash = 0;
+	//! The settings version of the plan cache when the hash was computed
+	idx_t plan_cache_settings_version = 0;
+
 	//! The Max Line Length Size of Last Query Executed on a CSV File. (Only used for testing)
 	//! FIXME: this should not be done like this
 	bool debug_set_max_line_length = false;
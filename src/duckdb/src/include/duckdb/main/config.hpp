@@ -62,6 +62,14 @@ enum class CheckpointAbort : uint8_t {
 	DEBUG_ABORT_AFTER_FREE_LIST_WRITE = 3
 };
 
+//! How committing transactions make their WAL entries durable
+//! SYNC: every commit fsyncs the WAL before it returns
+//! GROUP: concurrent commits are coalesced into a single fsync, each commit still waits for its entries to be synced.
+//! Transactions that start while a sync is pending wait for it, so that no commit is read before it is durable
+//! RELAXED: commits return before the fsync, the WAL is synced at least every wal_relaxed_sync_interval and when the
+//! database is closed
+enum class WALCommitMode : uint8_t { SYNC = 0, GROUP = 1, RELAXED = 2 };
+
 typedef void (*set_global_function_t)(DatabaseInstance *db, DBConfig &config, const Value &parameter);
 typedef void (*set_local_function_t)(ClientContext &context, const Value &parameter);
 typedef void (*reset_global_function_t)(DatabaseInstance *db, DBConfig &config);
@@ -125,6 +133,14 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! Whether automatic checkpoints run on a background thread instead of on the committing thread
+	bool checkpoint_in_background = false;
+	//! How commits make their WAL entries durable (SYNC, GROUP or RELAXED)
+	WALCommitMode wal_commit_mode = WALCommitMode::SYNC;
+	//! In GROUP commit mode, how long (in microseconds) the syncing commit waits for others to join before the fsync
+	idx_t wal_commit_delay = 0;
+	//! In RELAXED commit mode, the maximum time (in milliseconds) before an acknowledged commit is synced
+	idx_t wal_relaxed_sync_interval = 1000;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! Whether extensions should be loaded on start-up
@@ -175,6 +191,9 @@ struct DBConfigOptions {
 	bool enable_external_access = true;
 	//! Whether or not object cache is used
 	bool object_cache_enable = false;
+	//! Maximum memory used by evictable object cache entries (e.g. Parquet metadata), INVALID_INDEX = 10% of the
+	//! memory limit
+	idx_t object_cache_memory_limit = DConstants::INVALID_INDEX;
 	//! Whether or not the global http metadata cache is used
 	bool http_metadata_cache_enable = false;
 	//! HTTP Proxy config as 'hostname:port'
@@ -269,6 +288,8 @@ struct DBConfigOptions {
 	idx_t index_scan_max_count = STANDARD_VECTOR_SIZE;
 	//! The maximum number of schemas we will look through for "did you mean..." style errors in the catalog
 	idx_t catalog_error_max_schemas = 100;
+	//! The maximum number of plans kept in the plan cache (0 disables the plan cache)
+	idx_t plan_cache_size = 0;
 	//!  Whether or not to always write to the WAL file, even if this is not required
 	bool debug_skip_checkpoint_on_commit = false;
 	//! The maximum amount of vacuum tasks to schedule during a checkpoint
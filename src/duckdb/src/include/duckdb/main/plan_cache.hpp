@@ -0,0 +1,90 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/plan_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/case_insensitive_map.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/statement_type.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_ptr.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+class ClientContext;
+class DatabaseInstance;
+struct DataTableInfo;
+class PhysicalOperator;
+class PreparedStatementData;
+class SQLStatement;
+struct BoundParameterData;
+
+struct PlanCacheEntryInformation {
+	//! The normalized text of the statement
+	string query;
+	//! How often the cached plan has been reused
+	idx_t hits;
+};
+
+//! The PlanCache keeps the physical plans of statements that are executed repeatedly (across connections), keyed by
+//! the normalized statement text and the settings of the connection. A plan is only reused if the catalog of every
+//! database it reads from and the data of every table it scans are unchanged, and only by a single query at a time.
+//! Literals are not turned into parameters (constant folding and statistics make that unsafe), so only statements with
+//! identical text share a plan.
+class PlanCache {
+public:
+	explicit PlanCache(DatabaseInstance &db);
+	~PlanCache();
+
+	DUCKDB_API static PlanCache &Get(ClientContext &context);
+
+	//! Returns the key under which the plan of the statement is cached, or an empty string if it cannot be cached
+	string GetCacheKey(ClientContext &context, const SQLStatement &statement,
+	                   optional_ptr<case_insensitive_map_t<BoundParameterData>> values);
+	//! Returns the cached plan for the key, or nullptr if there is no valid plan that is not in use
+	shared_ptr<PreparedStatementData> Lookup(ClientContext &context, const string &key);
+	//! Caches the plan that was created for the key (if it can be reused)
+	void Insert(ClientContext &context, const string &key, const shared_ptr<PreparedStatementData> &prepared);
+	//! Returns the statements whose plans are currently cached
+	vector<PlanCacheEntryInformation> GetEntries();
+	//! Signals that a setting has changed, which changes the settings hash of every connection
+	void SettingsChanged();
+
+	//! Releases the operator states that a (cached) plan holds on to after it has been executed
+	static void ResetOperatorStates(PhysicalOperator &op);
+
+private:
+	struct CachedPlan {
+		shared_ptr<PreparedStatementData> prepared;
+		//! The last data change of every table the plan scans when it was created
+		vector<pair<shared_ptr<DataTableInfo>, transaction_t>> table_versions;
+		//! The identity of every catalog in the search path when the plan was created
+		vector<pair<string, StatementProperties::CatalogIdentity>> search_path_identities;
+		//! Used to evict the least recently used plan
+		idx_t last_used = 0;
+		//! How often the plan has been reused
+		idx_t hits = 0;
+	};
+
+	hash_t GetSettingsHash(ClientContext &context);
+	bool IsValid(ClientContext &context, const CachedPlan &plan);
+	idx_t GetMaxEntries() const;
+
+private:
+	DatabaseInstance &db;
+	mutex lock;
+	unordered_map<string, CachedPlan> cache;
+	//! Incremented on every lookup, used as LRU timestamp
+	idx_t use_counter;
+	//! Incremented whenever a setting changes
+	atomic<idx_t> settings_version;
+};
+
+} // namespace duckdb
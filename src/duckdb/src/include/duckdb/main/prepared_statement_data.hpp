@@ -45,6 +45,8 @@ public:
 	bound_parameter_map_t value_map;
 	//! Whether we are creating a streaming result or not
 	bool is_streaming = false;
+	//! Whether the plan is kept in the plan cache (and its operator states should be released after execution)
+	bool plan_cached = false;
 
 public:
 	void CheckParameterCount(idx_t parameter_count);
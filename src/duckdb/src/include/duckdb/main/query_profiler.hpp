@@ -138,6 +138,8 @@ public:
 	DUCKDB_API void EndPhase();
 
 	DUCKDB_API void Initialize(const PhysicalOperator &root);
+	//! Adds the timings of an operator that was created while executing to the node of an operator of the plan
+	DUCKDB_API void AddOperatorCopy(const PhysicalOperator &copy, const PhysicalOperator &op);
 
 	DUCKDB_API string QueryTreeToString() const;
 	DUCKDB_API void QueryTreeToStream(std::ostream &str) const;
@@ -262,6 +262,17 @@ struct CatalogErrorMaxSchemasSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct CheckpointInBackgroundSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "checkpoint_in_background";
+	static constexpr const char *Description =
+	    "Run automatic checkpoints on a background thread instead of on the committing thread";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct CheckpointThresholdSetting {
 	using RETURN_TYPE = string;
 	static constexpr const char *Name = "checkpoint_threshold";
@@ -449,6 +460,17 @@ struct DuckDBAPISetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableAdaptiveJoinOrderSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "enable_adaptive_join_order";
+	static constexpr const char *Description =
+	    "Whether chains of hash join probes are re-ordered when the sizes of their build sides were misestimated";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct EnableExternalAccessSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "enable_external_access";
@@ -463,6 +485,17 @@ struct EnableExternalAccessSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableFileIndexSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "enable_file_index";
+	static constexpr const char *Description =
+	    "Whether multi-file scans prune files using the file index (_duckdb_file_index) of their directory";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct EnableFSSTVectorsSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "enable_fsst_vectors";
@@ -603,6 +636,18 @@ struct ExternalThreadsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct FileIndexCheckChangesSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "file_index_check_changes";
+	static constexpr const char *Description =
+	    "Whether the file index only prunes files whose size and modification time are unchanged (this opens every "
+	    "pruned file)";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct FileSearchPathSetting {
 	using RETURN_TYPE = string;
 	static constexpr const char *Name = "file_search_path";
@@ -706,6 +751,17 @@ struct ImmediateTransactionModeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct IndexJoinThresholdSetting {
+	using RETURN_TYPE = idx_t;
+	static constexpr const char *Name = "index_join_threshold";
+	static constexpr const char *Description =
+	    "The maximum number of rows on the probe side to choose an index nested loop join against an indexed table";
+	static constexpr const char *InputType = "UBIGINT";
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct IndexScanMaxCountSetting {
 	using RETURN_TYPE = idx_t;
 	static constexpr const char *Name = "index_scan_max_count";
@@ -827,6 +883,18 @@ struct NestedLoopJoinThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct ObjectCacheMemoryLimitSetting {
+	using RETURN_TYPE = string;
+	static constexpr const char *Name = "object_cache_memory_limit";
+	static constexpr const char *Description =
+	    "The maximum memory used by evictable object cache entries such as Parquet metadata (e.g. 1GB), defaults to "
+	    "10% of the memory limit";
+	static constexpr const char *InputType = "VARCHAR";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct OldImplicitCastingSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "old_implicit_casting";
@@ -922,6 +990,17 @@ struct PivotLimitSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct PlanCacheSizeSetting {
+	using RETURN_TYPE = idx_t;
+	static constexpr const char *Name = "plan_cache_size";
+	static constexpr const char *Description =
+	    "The maximum number of query plans that are cached and reused for repeated queries (0 disables the cache)";
+	static constexpr const char *InputType = "UBIGINT";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct PreferRangeJoinsSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "prefer_range_joins";
@@ -1092,6 +1171,40 @@ struct UsernameSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct WalCommitDelaySetting {
+	using RETURN_TYPE = idx_t;
+	static constexpr const char *Name = "wal_commit_delay";
+	static constexpr const char *Description =
+	    "In group commit mode, the time in microseconds a syncing commit waits for other commits to join its fsync";
+	static constexpr const char *InputType = "UBIGINT";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WalCommitModeSetting {
+	using RETURN_TYPE = WALCommitMode;
+	static constexpr const char *Name = "wal_commit_mode";
+	static constexpr const char *Description =
+	    "How commits make the WAL durable: sync (fsync per commit), group (coalesce concurrent fsyncs) or relaxed "
+	    "(acknowledge before the fsync, sync at least every wal_relaxed_sync_interval)";
+	static constexpr const char *InputType = "VARCHAR";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WalRelaxedSyncIntervalSetting {
+	using RETURN_TYPE = idx_t;
+	static constexpr const char *Name = "wal_relaxed_sync_interval";
+	static constexpr const char *Description =
+	    "In relaxed commit mode, the maximum time in milliseconds before an acknowledged commit is synced to the WAL";
+	static constexpr const char *InputType = "UBIGINT";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 //===----------------------------------------------------------------------===//
 // End of the auto-generated list of settings structures
 //===--------------------------------------------------------------------===//
@@ -17,6 +17,7 @@ namespace duckdb {
 class Optimizer;
 class ClientContext;
 class LogicalOperator;
+struct CMStringDictionary;
 
 struct CMChildInfo {
 public:
@@ -28,6 +29,8 @@ public:
 	vector<LogicalType> &types;
 	//! Whether the input binding is eligible for compression
 	vector<bool> can_compress;
+	//! Whether the input binding is only carried along by the operator (and may be compressed without preserving order)
+	vector<bool> is_payload;
 
 	//! Bindings after compressing (projection on top)
 	vector<ColumnBinding> bindings_after;
@@ -44,6 +47,8 @@ public:
 	LogicalType type;
 	bool needs_decompression;
 	unique_ptr<BaseStatistics> stats;
+	//! The dictionary, if the binding is dictionary-encoded
+	shared_ptr<CMStringDictionary> dictionary;
 };
 
 struct CompressedMaterializationInfo {
@@ -67,6 +72,8 @@ public:
 public:
 	unique_ptr<Expression> expression;
 	unique_ptr<BaseStatistics> stats;
+	//! The dictionary, if the expression dictionary-encodes a string
+	shared_ptr<CMStringDictionary> dictionary;
 };
 
 typedef column_binding_map_t<unique_ptr<BaseStatistics>> statistics_map_t;
@@ -78,6 +85,8 @@ private:
 	//! Somewhat defensive constants that try to limit when compressed materialization is triggered for joins
 	static constexpr idx_t JOIN_BUILD_CARDINALITY_THRESHOLD = 1048576;
 	static constexpr double JOIN_CARDINALITY_RATIO_THRESHOLD = 8;
+	//! Payload strings are dictionary-encoded if their estimated number of distinct values is at most this
+	static constexpr idx_t DICTIONARY_CARDINALITY_THRESHOLD = 65536;
 
 public:
 	CompressedMaterialization(Optimizer &optimizer, LogicalOperator &root, statistics_map_t &statistics_map);
@@ -98,8 +107,11 @@ private:
 
 	//! Adds bindings referenced in expression to referenced_bindings
 	static void GetReferencedBindings(const Expression &expression, column_binding_set_t &referenced_bindings);
+	//! Marks the input bindings that are not referenced by the operator as payload
+	static void SetPayloadBindings(CompressedMaterializationInfo &info, const column_binding_set_t &key_bindings);
 	//! Updates CMBindingInfo in the binding_map in info
-	void UpdateBindingInfo(CompressedMaterializationInfo &info, const ColumnBinding &binding, bool needs_decompression);
+	void UpdateBindingInfo(CompressedMaterializationInfo &info, const ColumnBinding &binding, bool needs_decompression,
+	                       shared_ptr<CMStringDictionary> dictionary = nullptr);
 
 	//! Create (de)compress projections around the operator
 	void CreateProjections(unique_ptr<LogicalOperator> &op, CompressedMaterializationInfo &info);
@@ -112,10 +124,12 @@ private:
 
 	//! Create expressions that apply a scalar compression function
 	unique_ptr<CompressExpression> GetCompressExpression(const ColumnBinding &binding, const LogicalType &type,
-	                                                     const bool &can_compress);
+	                                                     const bool &can_compress, const bool &is_payload);
 	unique_ptr<CompressExpression> GetCompressExpression(unique_ptr<Expression> input, const BaseStatistics &stats);
 	unique_ptr<CompressExpression> GetIntegralCompress(unique_ptr<Expression> input, const BaseStatistics &stats);
 	unique_ptr<CompressExpression> GetStringCompress(unique_ptr<Expression> input, const BaseStatistics &stats);
+	unique_ptr<CompressExpression> GetStringDictionaryCompress(unique_ptr<Expression> input,
+	                                                           const BaseStatistics &stats);
 
 	//! Create an expression that applies a scalar decompression function
 	unique_ptr<Expression> GetDecompressExpression(unique_ptr<Expression> input, const LogicalType &result_type,
@@ -124,6 +138,8 @@ private:
 	                                             const BaseStatistics &stats);
 	unique_ptr<Expression> GetStringDecompress(unique_ptr<Expression> input, const LogicalType &result_type,
 	                                           const BaseStatistics &stats);
+	unique_ptr<Expression> GetStringDictionaryDecompress(unique_ptr<Expression> input, const LogicalType &result_type,
+	                                                     shared_ptr<CMStringDictionary> dictionary);
 
 private:
 	Optimizer &optimizer;
@@ -89,6 +89,8 @@ class CardinalityEstimator {
 public:
 	static constexpr double DEFAULT_SEMI_ANTI_SELECTIVITY = 5;
 	static constexpr double DEFAULT_LT_GT_MULTIPLIER = 2.5;
+	//! The minimum amount of matching sample rows for a sampled join selectivity to be used
+	static constexpr idx_t MINIMUM_SAMPLED_JOIN_MATCHES = 10;
 	explicit CardinalityEstimator() {};
 
 private:
@@ -96,6 +98,8 @@ private:
 	unordered_map<string, CardinalityHelper> relation_set_2_cardinality;
 	JoinRelationSetManager set_manager;
 	vector<RelationStats> relation_stats;
+	//! filter index -> the denominator of the join between two base tables, estimated by joining their samples
+	unordered_map<idx_t, double> sampled_denominators;
 
 public:
 	void RemoveEmptyTotalDomains();
@@ -103,6 +107,10 @@ public:
 	void InitEquivalentRelations(const vector<unique_ptr<FilterInfo>> &filter_infos);
 
 	void InitCardinalityEstimatorProps(optional_ptr<JoinRelationSet> set, RelationStats &stats);
+	//! Estimate the selectivity of the equi-joins between pairs of base tables by joining samples of the tables.
+	//! This captures skew and correlated (multi-column) join keys that total domains cannot.
+	void InitSampledJoinSelectivities(ClientContext &context, const vector<unique_ptr<FilterInfo>> &filter_infos,
+	                                  const vector<RelationStats> &relation_stats);
 
 	//! cost model needs estimated cardinalities to the fraction since the formula captures
 	//! distinct count selectivities and multiplicities. Hence the template
@@ -13,6 +13,8 @@
 namespace duckdb {
 
 class CardinalityEstimator;
+class DataChunk;
+class LogicalGet;
 
 struct DistinctCount {
 	idx_t distinct_count;
@@ -31,6 +33,8 @@ struct RelationStats {
 	idx_t cardinality;
 	double filter_strength = 1;
 	bool stats_initialized = false;
+	//! The base table scan this relation consists of (if any), used to sample its join keys
+	optional_ptr<LogicalGet> table_scan;
 
 	// for debug, column names and tables
 	vector<string> column_names;
@@ -51,6 +55,10 @@ public:
 	//	                                  BaseStatistics &base_stats);
 	//! Extract Statistics from a LogicalGet.
 	static RelationStats ExtractGetStats(LogicalGet &get, ClientContext &context);
+	//! Extract a sample of the given columns of a base table scan, with the table filters of the scan applied.
+	//! Returns nullptr if no sample of the table is available.
+	static unique_ptr<DataChunk> ExtractGetSample(LogicalGet &get, ClientContext &context,
+	                                              const vector<idx_t> &columns);
 	static RelationStats ExtractDelimGetStats(LogicalDelimGet &delim_get, ClientContext &context);
 	//! Create the statistics for a projection using the statistics of the operator that sits underneath the
 	//! projection. Then also create statistics for any extra columns the projection creates.
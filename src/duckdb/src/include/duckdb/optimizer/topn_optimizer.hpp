@@ -11,15 +11,26 @@
 #include "duckdb/common/constants.hpp"
 
 namespace duckdb {
+class ClientContext;
 class LogicalOperator;
+class LogicalTopN;
 class Optimizer;
 
 class TopN {
 public:
+	explicit TopN(ClientContext &context);
+
 	//! Optimize ORDER BY + LIMIT to TopN
 	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
 	//! Whether we can perform the optimization on this operator
 	static bool CanOptimize(LogicalOperator &op);
+
+private:
+	//! Try to replace a table scan below the TopN with an ordered scan over an ART index
+	void PushdownIndexScan(LogicalTopN &topn);
+
+private:
+	ClientContext &context;
 };
 
 } // namespace duckdb
@@ -73,6 +73,7 @@ class Pipeline : public enable_shared_from_this<Pipeline> {
 	friend class PipelineFinishEvent;
 	friend class PipelineBuildState;
 	friend class MetaPipeline;
+	friend class AdaptiveJoinOrder;
 
 public:
 	explicit Pipeline(Executor &execution_context);
@@ -131,6 +132,8 @@ private:
 	vector<reference<PhysicalOperator>> operators;
 	//! The sink (i.e. destination) for data; this is e.g. a hash table to-be-built
 	optional_ptr<PhysicalOperator> sink;
+	//! The operators that were created for this pipeline while executing (e.g. re-ordered joins)
+	vector<unique_ptr<PhysicalOperator>> owned_operators;
 
 	//! The global source state
 	unique_ptr<GlobalSourceState> source_state;
@@ -45,6 +45,8 @@ public:
 	vector<idx_t> partition_columns;
 	vector<string> names;
 	vector<LogicalType> expected_types;
+	//! Whether to add the written files to the file index of the output directory
+	bool file_index = false;
 
 public:
 	vector<ColumnBinding> GetColumnBindings() override;
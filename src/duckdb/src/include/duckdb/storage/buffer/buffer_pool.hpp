@@ -13,6 +13,7 @@
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/typedefs.hpp"
+#include "duckdb/common/vector.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
 
 namespace duckdb {
@@ -32,6 +33,18 @@ struct BufferEvictionNode {
 	shared_ptr<BlockHandle> TryGetBlockHandle();
 };
 
+//! A memory consumer that is accounted in the buffer pool but does not live in its eviction queues (e.g., the object
+//! cache). Registered consumers are asked to release memory when unloading blocks is not enough to stay in the limit.
+class EvictableMemoryConsumer {
+public:
+	virtual ~EvictableMemoryConsumer() {
+	}
+
+	//! Try to release at least "bytes" bytes of accounted memory, returns the number of bytes actually released.
+	//! Called from arbitrary threads that are allocating memory: implementations must not block on their own locks.
+	virtual idx_t ReleaseMemory(idx_t bytes) = 0;
+};
+
 //! The BufferPool is in charge of handling memory management for one or more databases. It defines memory limits
 //! and implements priority eviction among all users of the pool.
 class BufferPool {
@@ -62,6 +75,10 @@ public:
 
 	TemporaryMemoryManager &GetTemporaryMemoryManager();
 
+	//! Register/unregister a consumer that releases memory when the pool cannot evict enough blocks
+	void RegisterConsumer(EvictableMemoryConsumer &consumer);
+	void UnregisterConsumer(EvictableMemoryConsumer &consumer);
+
 protected:
 	//! Evict blocks until the currently used memory + extra_memory fit, returns false if this was not possible
 	//! (i.e. not enough blocks could be evicted)
@@ -78,6 +95,10 @@ protected:
 	virtual EvictionResult EvictBlocksInternal(EvictionQueue &queue, MemoryTag tag, idx_t extra_memory,
 	                                           idx_t memory_limit, unique_ptr<FileBuffer> *buffer = nullptr);
 
+	//! Ask the registered consumers to release memory until the currently used memory + extra_memory fit, returns
+	//! true if any memory was released
+	bool ReleaseConsumerMemory(idx_t extra_memory, idx_t memory_limit);
+
 	//! Purge all blocks that haven't been pinned within the last N seconds
 	idx_t PurgeAgedBlocks(uint32_t max_age_sec);
 	idx_t PurgeAgedBlocksInternal(EvictionQueue &queue, uint32_t max_age_sec, int64_t now, int64_t limit);
@@ -158,6 +179,10 @@ protected:
 	//! and only updates the global counter when the cache value exceeds a threshold.
 	//! Therefore, the statistics may have slight differences from the actual memory usage.
 	mutable MemoryUsage memory_usage;
+	//! The lock for the registered consumers
+	mutex consumer_lock;
+	//! Memory consumers outside of the eviction queues
+	vector<reference<EvictableMemoryConsumer>> consumers;
 };
 
 } // namespace duckdb
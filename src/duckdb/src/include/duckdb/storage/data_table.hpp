@@ -179,6 +179,8 @@ public:
 
 	//! Get statistics of a physical column within the table
 	unique_ptr<BaseStatistics> GetStatistics(ClientContext &context, column_t column_id);
+	//! Get a uniform sample of the rows of the given physical columns (the sample is drawn if there is none yet)
+	unique_ptr<DataChunk> GetSample(ClientContext &context, const vector<column_t> &column_ids);
 	//! Sets statistics of a physical column within the table
 	void SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats);
 
@@ -9,11 +9,14 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/string.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
 
 namespace duckdb {
 
@@ -24,17 +27,28 @@ public:
 	}
 
 	virtual string GetObjectType() = 0;
+
+	//! The (rough) amount of memory held by this entry. Entries that report a size are accounted in the buffer pool
+	//! and are evicted in least-recently-used order once the object cache exceeds its memory limit, or when the buffer
+	//! pool needs the memory. Entries that do not report a size are never evicted.
+	virtual optional_idx GetEstimatedCacheMemory() const {
+		return optional_idx();
+	}
 };
 
-class ObjectCache {
+class ObjectCache : public EvictableMemoryConsumer {
 public:
+	explicit ObjectCache(DatabaseInstance &db);
+	~ObjectCache() override;
+
 	shared_ptr<ObjectCacheEntry> GetObject(const string &key) {
 		lock_guard<mutex> glock(lock);
 		auto entry = cache.find(key);
 		if (entry == cache.end()) {
 			return nullptr;
 		}
-		return entry->second;
+		Touch(entry->second);
+		return entry->second.object;
 	}
 
 	template <class T>
@@ -53,10 +67,11 @@ public:
 		auto entry = cache.find(key);
 		if (entry == cache.end()) {
 			auto value = make_shared_ptr<T>(args...);
-			cache[key] = value;
+			PutInternal(key, value);
 			return value;
 		}
-		auto object = entry->second;
+		Touch(entry->second);
+		auto object = entry->second.object;
 		if (!object || object->GetObjectType() != T::ObjectType()) {
 			return nullptr;
 		}
@@ -65,20 +80,53 @@ public:
 
 	void Put(string key, shared_ptr<ObjectCacheEntry> value) {
 		lock_guard<mutex> glock(lock);
-		cache.insert(make_pair(std::move(key), std::move(value)));
+		PutInternal(std::move(key), std::move(value));
 	}
 
 	void Delete(const string &key) {
 		lock_guard<mutex> glock(lock);
-		cache.erase(key);
+		auto entry = cache.find(key);
+		if (entry != cache.end()) {
+			EraseInternal(entry);
+		}
 	}
 
+	//! Evict entries until the accounted memory of the cache fits within its memory limit
+	DUCKDB_API void EvictToLimit();
+	//! Returns the memory currently accounted to evictable entries of the cache
+	DUCKDB_API idx_t GetMemoryUsage();
+	//! Evict least-recently-used entries until at least "bytes" bytes are released (called by the buffer pool)
+	idx_t ReleaseMemory(idx_t bytes) override;
+
 	DUCKDB_API static ObjectCache &GetObjectCache(ClientContext &context);
 	DUCKDB_API static bool ObjectCacheEnabled(ClientContext &context);
 
 private:
+	struct CachedObject {
+		shared_ptr<ObjectCacheEntry> object;
+		//! The memory accounted for this object (0 if the object is not evictable)
+		idx_t memory = 0;
+		//! Position in the LRU list (only valid if the object is evictable)
+		list<string>::iterator lru_position;
+	};
+	using cache_iterator_t = unordered_map<string, CachedObject>::iterator;
+
+	//! Moves an evictable entry to the front of the LRU list
+	void Touch(CachedObject &entry);
+	DUCKDB_API void PutInternal(string key, shared_ptr<ObjectCacheEntry> value);
+	void EraseInternal(cache_iterator_t entry);
+	void EvictInternal();
+	idx_t GetMemoryLimit() const;
+
+private:
+	DatabaseInstance &db;
+	BufferPool &buffer_pool;
 	//! Object Cache
-	unordered_map<string, shared_ptr<ObjectCacheEntry>> cache;
+	unordered_map<string, CachedObject> cache;
+	//! Keys of evictable entries, most recently used first
+	list<string> lru;
+	//! Total memory accounted to evictable entries
+	idx_t memory_usage;
 	mutex lock;
 };
 
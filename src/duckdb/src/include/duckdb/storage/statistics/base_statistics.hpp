@@ -109,7 +109,7 @@ public:
 
 	string ToString() const;
 
-	idx_t GetDistinctCount();
+	idx_t GetDistinctCount() const;
 	static BaseStatistics FromConstant(const Value &input);
 
 	template <class T>
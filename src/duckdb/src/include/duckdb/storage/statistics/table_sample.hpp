@@ -0,0 +1,61 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/statistics/table_sample.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/random_engine.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+
+namespace duckdb {
+
+//! The TableSample keeps a uniform sample of the rows that are appended to a table (reservoir sampling using
+//! "Algorithm L"). It is used by the optimizer to estimate the selectivity of joins.
+class TableSample {
+public:
+	TableSample(Allocator &allocator, const vector<LogicalType> &types, idx_t sample_size = STANDARD_VECTOR_SIZE);
+
+public:
+	//! Add the rows of the chunk to the sample
+	void Append(DataChunk &input);
+	//! Merge the sample of other rows into this sample
+	void Merge(TableSample &other);
+	//! Use the given rows, a uniform sample of (approximately) total_rows rows, as the sample
+	void Initialize(DataChunk &rows, idx_t total_rows);
+	//! Copy the given columns of the sample rows into a new chunk (or nullptr if the sample is empty)
+	unique_ptr<DataChunk> GetSample(const vector<column_t> &column_ids) const;
+
+	idx_t RowsSeen() const {
+		return rows_seen;
+	}
+
+private:
+	void InitializeSample(idx_t capacity);
+	//! Returns a random number in (0, 1]
+	double NextRandom();
+	//! Compute the index of the next row that enters the sample
+	void NextSampleIndex();
+	//! Continue sampling once the sample is full, after rows_seen rows have been processed
+	void InitializeSkip(double threshold);
+
+private:
+	Allocator &allocator;
+	vector<LogicalType> types;
+	idx_t sample_size;
+	//! The sample rows
+	DataChunk sample;
+	//! The amount of rows that were offered to the sample
+	idx_t rows_seen = 0;
+	//! The (global) index of the next row that replaces a sample row
+	idx_t next_sample_index = 0;
+	//! The current threshold of "Algorithm L"
+	double threshold = 1;
+	RandomEngine random;
+};
+
+} // namespace duckdb
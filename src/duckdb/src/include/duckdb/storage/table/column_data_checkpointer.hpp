@@ -25,6 +25,8 @@ public:
 	const LogicalType &GetType() const;
 	ColumnData &GetColumnData();
 	RowGroup &GetRowGroup();
+	//! The first row of the range of segments that is currently being rewritten
+	idx_t GetRowStart() const;
 	ColumnCheckpointState &GetCheckpointState();
 
 	void Checkpoint(vector<SegmentNode<ColumnSegment>> nodes);
@@ -32,9 +34,10 @@ public:
 
 private:
 	void ScanSegments(const std::function<void(Vector &, idx_t)> &callback);
+	void InitializeCompressionFunctions();
 	unique_ptr<AnalyzeState> DetectBestCompressionMethod(idx_t &compression_idx);
 	void WriteToDisk();
-	bool HasChanges();
+	bool HasChanges(idx_t segment_idx);
 	void WritePersistentSegments();
 
 private:
@@ -44,6 +47,9 @@ private:
 	bool is_validity;
 	Vector intermediate;
 	vector<SegmentNode<ColumnSegment>> nodes;
+	//! The range of nodes [range_start, range_end) that is currently being checkpointed
+	idx_t range_start;
+	idx_t range_end;
 	vector<optional_ptr<CompressionFunction>> compression_functions;
 	ColumnCheckpointInfo &checkpoint_info;
 };
@@ -48,6 +48,21 @@ public:
 		return checkpoint_lock.GetSharedLock();
 	}
 
+	//! The commit id of the last transaction that changed the data of the table (0 if none since it was loaded)
+	transaction_t GetLastChangeCommit() const {
+		return last_change_commit;
+	}
+	void SetLastChangeCommit(transaction_t commit_id) {
+		last_change_commit = commit_id;
+	}
+	//! Signals that rows were deleted, updated or reverted - which the sample of the appended rows does not reflect
+	void InvalidateSample() {
+		sample_version++;
+	}
+	idx_t GetSampleVersion() const {
+		return sample_version;
+	}
+
 	string GetSchemaName();
 	string GetTableName();
 	void SetTableName(string name);
@@ -69,6 +84,10 @@ private:
 	vector<IndexStorageInfo> index_storage_infos;
 	//! Lock held while checkpointing
 	StorageLock checkpoint_lock;
+	//! The commit id of the last transaction that changed the data of the table
+	atomic<transaction_t> last_change_commit = {0};
+	//! Incremented whenever the sample of the table has to be rebuilt
+	atomic<idx_t> sample_version = {0};
 };
 
 } // namespace duckdb
@@ -13,6 +13,7 @@
 #include "duckdb/execution/reservoir_sample.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/statistics/column_statistics.hpp"
+#include "duckdb/storage/statistics/table_sample.hpp"
 
 namespace duckdb {
 class ColumnList;
@@ -37,6 +38,8 @@ public:
 	void InitializeRemoveColumn(TableStatistics &parent, idx_t removed_column);
 	void InitializeAlterType(TableStatistics &parent, idx_t changed_idx, const LogicalType &new_type);
 	void InitializeAddConstraint(TableStatistics &parent);
+	//! Start keeping a sample of the appended rows - only possible for tables that are empty
+	void InitializeSample(const vector<LogicalType> &types, idx_t sample_version);
 
 	void MergeStats(TableStatistics &other);
 	void MergeStats(idx_t i, BaseStatistics &stats);
@@ -45,6 +48,12 @@ public:
 	void CopyStats(TableStatistics &other);
 	void CopyStats(TableStatisticsLock &lock, TableStatistics &other);
 	unique_ptr<BaseStatistics> CopyStats(idx_t i);
+	//! Add appended rows to the sample (if any)
+	void UpdateSample(DataChunk &chunk);
+	//! Copy the given columns of the sample, or nullptr if there is no sample of the table (for the given version)
+	unique_ptr<DataChunk> GetSample(const vector<column_t> &column_ids, idx_t sample_version);
+	//! Replace the sample with one that was drawn at the given sample version
+	void SetSample(unique_ptr<TableSample> sample, idx_t sample_version);
 	//! Get a reference to the stats - this requires us to hold the lock.
 	//! The reference can only be safely accessed while the lock is held
 	ColumnStatistics &GetStats(TableStatisticsLock &lock, idx_t i);
@@ -64,6 +73,10 @@ private:
 	//! The table sample
 	//! Sample for table
 	unique_ptr<BlockingSample> table_sample;
+	//! A uniform sample of the rows appended to the table (not persisted)
+	unique_ptr<TableSample> append_sample;
+	//! The sample version of the table (see DataTableInfo) that the sample reflects
+	idx_t append_sample_version = 0;
 };
 
 } // namespace duckdb
@@ -13,13 +13,17 @@
 #include "duckdb/catalog/catalog_entry/sequence_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_macro_catalog_entry.hpp"
 #include "duckdb/common/enums/wal_type.hpp"
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -114,11 +118,30 @@ public:
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
 	void Flush();
+	//! Writes the flush marker of a committing transaction. Depending on the WAL commit mode, the WAL is either synced
+	//! directly, or the sync is left to SyncCommits so that concurrent commits can share a single fsync.
+	void FlushCommit();
+	//! Waits until all commits flushed so far are synced to disk - performing the sync if no other commit is doing so
+	void SyncCommits();
+	//! Waits until the first "target" flushed commits are synced to disk
+	void SyncCommits(idx_t target);
+	//! The number of commits whose entries have been written (but not necessarily synced) to the WAL file
+	idx_t GetFlushedCommits() const {
+		return flushed_commits;
+	}
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
 protected:
 	static unique_ptr<WriteAheadLog> ReplayInternal(AttachedDatabase &database, unique_ptr<FileHandle> handle);
+	//! Syncs the WAL file and marks all commits flushed before the sync as durable
+	void SyncFlushedCommits();
+	//! Starts the thread that syncs relaxed commits once wal_relaxed_sync_interval has passed (requires the sync_lock)
+	void StartRelaxedSyncThread();
+	//! Body of the relaxed sync thread
+	void RelaxedSyncLoop();
+	//! Stops the relaxed sync thread and syncs any outstanding commits
+	void StopRelaxedSync() noexcept;
 
 protected:
 	AttachedDatabase &database;
@@ -127,6 +150,25 @@ protected:
 	string wal_path;
 	atomic<idx_t> wal_size;
 	atomic<WALInitState> init_state;
+
+	//! The number of commits whose entries have been written to the WAL file
+	atomic<idx_t> flushed_commits;
+	//! Protects the group commit state below
+	mutex sync_lock;
+	//! Signalled whenever a WAL sync completes
+	std::condition_variable sync_finished;
+	//! Whether or not a commit is currently syncing the WAL on behalf of the others
+	bool sync_in_progress = false;
+	//! The number of commits whose entries are known to be synced to disk
+	idx_t synced_commits = 0;
+	//! When the WAL was last synced
+	time_point<steady_clock> last_sync;
+	//! In RELAXED mode, syncs commits that are not followed by another commit within the sync interval
+	unique_ptr<thread> relaxed_sync_thread;
+	//! Signalled to stop the relaxed sync thread
+	std::condition_variable relaxed_sync_signal;
+	//! Whether the relaxed sync thread should stop
+	bool stop_relaxed_sync = false;
 };
 
 } // namespace duckdb
@@ -15,6 +15,7 @@
 namespace duckdb {
 class DuckTransaction;
 struct UndoBufferProperties;
+struct BackgroundCheckpointState;
 
 //! The Transaction Manager is responsible for creating and managing
 //! transactions
@@ -59,6 +60,12 @@ public:
 	void PushCatalogEntry(Transaction &transaction_p, CatalogEntry &entry, data_ptr_t extra_data = nullptr,
 	                      idx_t extra_data_size = 0);
 
+	//! Runs an automatic checkpoint on the current (background) thread - if one is still required. Returns false if
+	//! writers are active and the checkpoint lock could not be obtained.
+	bool BackgroundCheckpoint();
+	//! Prevents any scheduled background checkpoint from running, and waits for a running one to finish
+	void StopBackgroundCheckpoints();
+
 protected:
 	struct CheckpointDecision {
 		explicit CheckpointDecision(string reason_p);
@@ -68,6 +75,8 @@ protected:
 		bool can_checkpoint;
 		string reason;
 		CheckpointType type;
+		//! Whether the automatic checkpoint is deferred to a background thread
+		bool background_checkpoint = false;
 	};
 
 private:
@@ -81,6 +90,10 @@ private:
 	//! Whether or not we can checkpoint
 	CheckpointDecision CanCheckpoint(DuckTransaction &transaction, unique_ptr<StorageLockKey> &checkpoint_lock,
 	                                 const UndoBufferProperties &properties);
+	//! Whether or not automatic checkpoints can be run on a background thread
+	bool CanCheckpointInBackground();
+	//! Schedules an automatic checkpoint on a background thread (if none is scheduled yet)
+	void ScheduleBackgroundCheckpoint();
 
 private:
 	//! The current start timestamp used by transactions
@@ -110,6 +123,8 @@ private:
 
 	atomic<idx_t> last_uncommitted_catalog_version = {TRANSACTION_ID_START};
 	idx_t last_committed_version = 0;
+	//! State shared with scheduled background checkpoint tasks
+	shared_ptr<BackgroundCheckpointState> background_checkpoint_state;
 
 protected:
 	virtual void OnCommitCheckpointDecision(const CheckpointDecision &decision, DuckTransaction &transaction) {
@@ -224,6 +224,11 @@ void AttachedDatabase::Close() {
 	}
 	is_closed = true;
 
+	if (transaction_manager && transaction_manager->IsDuckTransactionManager()) {
+		// make sure no background checkpoint runs concurrently with (or after) closing the database
+		DuckTransactionManager::Get(*this).StopBackgroundCheckpoints();
+	}
+
 	if (!IsSystem() && !catalog->InMemory()) {
 		db.GetDatabaseManager().EraseDatabasePath(catalog->GetDBPath());
 	}
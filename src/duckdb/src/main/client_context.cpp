@@ -20,6 +20,7 @@
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/query_result.hpp"
 #include "duckdb/main/relation.hpp"
@@ -213,6 +214,11 @@ ErrorData ClientContext::EndQueryInternal(ClientContextLock &lock, bool success,
 	active_query->progress_bar.reset();
 
 	D_ASSERT(active_query.get());
+	if (active_query->prepared && active_query->prepared->plan_cached) {
+		// the plan outlives this query: release the states its operators hold
+		active_query->executor.reset();
+		PlanCache::ResetOperatorStates(*active_query->prepared->plan);
+	}
 	active_query.reset();
 	query_progress.Initialize();
 	ErrorData error;
@@ -369,6 +375,9 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 	// now convert logical query plan into a physical query plan
 	PhysicalPlanGenerator physical_planner(*this);
 	auto physical_plan = physical_planner.CreatePlan(std::move(plan));
+	if (physical_planner.requires_rebind) {
+		result->properties.always_require_rebind = true;
+	}
 	profiler.EndPhase();
 
 #ifdef DEBUG
@@ -426,6 +435,16 @@ ClientContext::CreatePreparedStatement(ClientContextLock &lock, const string &qu
 	return CreatePreparedStatementInternal(lock, query, std::move(statement), values);
 }
 
+bool ClientContext::CanCachePlan() {
+	// registered states can alter plans when they are prepared or executed, which a cached plan bypasses
+	for (auto &state : registered_state->States()) {
+		if (state->CanRequestRebind()) {
+			return false;
+		}
+	}
+	return true;
+}
+
 QueryProgress ClientContext::GetQueryProgress() {
 	return query_progress;
 }
@@ -659,7 +678,17 @@ unique_ptr<PreparedStatement> ClientContext::PrepareInternal(ClientContextLock &
 	shared_ptr<PreparedStatementData> prepared_data;
 	auto unbound_statement = statement->Copy();
 	RunFunctionInTransactionInternal(
-	    lock, [&]() { prepared_data = CreatePreparedStatement(lock, statement_query, std::move(statement)); }, false);
+	    lock,
+	    [&]() {
+		    auto &plan_cache = PlanCache::Get(*this);
+		    auto plan_cache_key = CanCachePlan() ? plan_cache.GetCacheKey(*this, *statement, nullptr) : string();
+		    prepared_data = plan_cache.Lookup(*this, plan_cache_key);
+		    if (!prepared_data) {
+			    prepared_data = CreatePreparedStatement(lock, statement_query, std::move(statement));
+			    plan_cache.Insert(*this, plan_cache_key, prepared_data);
+		    }
+	    },
+	    false);
 	prepared_data->unbound_statement = std::move(unbound_statement);
 	return make_uniq<PreparedStatement>(shared_from_this(), std::move(prepared_data), std::move(statement_query),
 	                                    std::move(named_param_map));
@@ -742,8 +771,14 @@ unique_ptr<PendingQueryResult> ClientContext::PendingStatementInternal(ClientCon
 		PreparedStatement::VerifyParameters(*parameters.parameters, statement->named_param_map);
 	}
 
-	auto prepared = CreatePreparedStatement(lock, query, std::move(statement), parameters.parameters,
-	                                        PreparedStatementMode::PREPARE_AND_EXECUTE);
+	auto &plan_cache = PlanCache::Get(*this);
+	auto plan_cache_key = CanCachePlan() ? plan_cache.GetCacheKey(*this, *statement, parameters.parameters) : string();
+	auto prepared = plan_cache.Lookup(*this, plan_cache_key);
+	if (!prepared) {
+		prepared = CreatePreparedStatement(lock, query, std::move(statement), parameters.parameters,
+		                                   PreparedStatementMode::PREPARE_AND_EXECUTE);
+		plan_cache.Insert(*this, plan_cache_key, prepared);
+	}
 
 	idx_t parameter_count = !parameters.parameters ? 0 : parameters.parameters->size();
 	if (prepared->properties.parameter_count > 0 && parameter_count == 0) {
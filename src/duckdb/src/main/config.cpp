@@ -75,6 +75,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AutoinstallKnownExtensionsSetting),
     DUCKDB_GLOBAL(AutoloadKnownExtensionsSetting),
     DUCKDB_GLOBAL(CatalogErrorMaxSchemasSetting),
+    DUCKDB_GLOBAL(CheckpointInBackgroundSetting),
     DUCKDB_GLOBAL(CheckpointThresholdSetting),
     DUCKDB_GLOBAL_ALIAS("wal_autocheckpoint", CheckpointThresholdSetting),
     DUCKDB_GLOBAL(CustomExtensionRepositorySetting),
@@ -95,7 +96,9 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(DisabledFilesystemsSetting),
     DUCKDB_GLOBAL(DisabledOptimizersSetting),
     DUCKDB_GLOBAL(DuckDBAPISetting),
+    DUCKDB_LOCAL(EnableAdaptiveJoinOrderSetting),
     DUCKDB_GLOBAL(EnableExternalAccessSetting),
+    DUCKDB_LOCAL(EnableFileIndexSetting),
     DUCKDB_GLOBAL(EnableFSSTVectorsSetting),
     DUCKDB_LOCAL(EnableHTTPLoggingSetting),
     DUCKDB_GLOBAL(EnableHTTPMetadataCacheSetting),
@@ -109,6 +112,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(ExplainOutputSetting),
     DUCKDB_GLOBAL(ExtensionDirectorySetting),
     DUCKDB_GLOBAL(ExternalThreadsSetting),
+    DUCKDB_LOCAL(FileIndexCheckChangesSetting),
     DUCKDB_LOCAL(FileSearchPathSetting),
     DUCKDB_GLOBAL(ForceBitpackingModeSetting),
     DUCKDB_GLOBAL(ForceCompressionSetting),
@@ -119,6 +123,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(HTTPProxyUsernameSetting),
     DUCKDB_LOCAL(IEEEFloatingPointOpsSetting),
     DUCKDB_GLOBAL(ImmediateTransactionModeSetting),
+    DUCKDB_LOCAL(IndexJoinThresholdSetting),
     DUCKDB_GLOBAL(IndexScanMaxCountSetting),
     DUCKDB_GLOBAL(IndexScanPercentageSetting),
     DUCKDB_LOCAL(IntegerDivisionSetting),
@@ -131,6 +136,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(MaxVacuumTasksSetting),
     DUCKDB_LOCAL(MergeJoinThresholdSetting),
     DUCKDB_LOCAL(NestedLoopJoinThresholdSetting),
+    DUCKDB_GLOBAL(ObjectCacheMemoryLimitSetting),
     DUCKDB_GLOBAL(OldImplicitCastingSetting),
     DUCKDB_LOCAL(OrderByNonIntegerLiteralSetting),
     DUCKDB_LOCAL(OrderedAggregateThresholdSetting),
@@ -140,6 +146,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(PerfectHtThresholdSetting),
     DUCKDB_LOCAL(PivotFilterThresholdSetting),
     DUCKDB_LOCAL(PivotLimitSetting),
+    DUCKDB_GLOBAL(PlanCacheSizeSetting),
     DUCKDB_LOCAL(PreferRangeJoinsSetting),
     DUCKDB_LOCAL(PreserveIdentifierCaseSetting),
     DUCKDB_GLOBAL(PreserveInsertionOrderSetting),
@@ -159,6 +166,9 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL_ALIAS("worker_threads", ThreadsSetting),
     DUCKDB_GLOBAL(UsernameSetting),
     DUCKDB_GLOBAL_ALIAS("user", UsernameSetting),
+    DUCKDB_GLOBAL(WalCommitDelaySetting),
+    DUCKDB_GLOBAL(WalCommitModeSetting),
+    DUCKDB_GLOBAL(WalRelaxedSyncIntervalSetting),
     FINAL_SETTING};
 
 vector<ConfigurationOption> DBConfig::GetOptions() {
@@ -0,0 +1,284 @@
+#include "duckdb/main/plan_cache.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/parser/sql_statement.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/duck_transaction_manager.hpp"
+
+namespace duckdb {
+
+PlanCache::PlanCache(DatabaseInstance &db) : db(db), use_counter(0), settings_version(1) {
+}
+
+PlanCache::~PlanCache() {
+}
+
+PlanCache &PlanCache::Get(ClientContext &context) {
+	return DatabaseInstance::GetDatabase(context).GetPlanCache();
+}
+
+idx_t PlanCache::GetMaxEntries() const {
+	return DBConfig::GetConfig(db).options.plan_cache_size;
+}
+
+hash_t PlanCache::GetSettingsHash(ClientContext &context) {
+	auto &client_data = ClientData::Get(context);
+	auto version = settings_version.load();
+	if (client_data.plan_cache_settings_version == version) {
+		return client_data.plan_cache_settings_hash;
+	}
+	// settings affect binding (e.g., the search path) and optimization (e.g., disabled optimizers)
+	hash_t result = 0;
+	auto options_count = DBConfig::GetOptionCount();
+	for (idx_t i = 0; i < options_count; i++) {
+		auto option = DBConfig::GetOptionByIndex(i);
+		D_ASSERT(option);
+		auto value = option->get_setting(context).ToString();
+		result = CombineHash(result, Hash(option->name));
+		result = CombineHash(result, Hash(value.c_str(), value.size()));
+	}
+	auto &config = DBConfig::GetConfig(context);
+	for (auto &ext_param : config.extension_parameters) {
+		Value setting_val;
+		if (context.TryGetCurrentSetting(ext_param.first, setting_val)) {
+			auto value = setting_val.ToString();
+			result = CombineHash(result, Hash(ext_param.first.c_str(), ext_param.first.size()));
+			result = CombineHash(result, Hash(value.c_str(), value.size()));
+		}
+	}
+	// user variables can be folded into the plan by getvariable - their order differs between clients
+	hash_t variables_hash = 0;
+	for (auto &variable : ClientConfig::GetConfig(context).user_variables) {
+		auto value = variable.second.ToString();
+		variables_hash ^= CombineHash(Hash(variable.first.c_str(), variable.first.size()),
+		                              Hash(value.c_str(), value.size()));
+	}
+	result = CombineHash(result, variables_hash);
+
+	client_data.plan_cache_settings_hash = result;
+	client_data.plan_cache_settings_version = version;
+	return result;
+}
+
+void PlanCache::SettingsChanged() {
+	++settings_version;
+}
+
+string PlanCache::GetCacheKey(ClientContext &context, const SQLStatement &statement,
+                              optional_ptr<case_insensitive_map_t<BoundParameterData>> values) {
+	if (GetMaxEntries() == 0 || statement.type != StatementType::SELECT_STATEMENT) {
+		return string();
+	}
+	if (values && !values->empty()) {
+		return string();
+	}
+	// only fresh (auto-commit) transactions see exactly the committed data the plan was created for
+	if (!context.transaction.IsAutoCommit() || ClientConfig::GetConfig(context).query_verification_enabled) {
+		return string();
+	}
+	string statement_text;
+	try {
+		statement_text = statement.ToString();
+	} catch (std::exception &) {
+		return string();
+	}
+	return to_string(GetSettingsHash(context)) + ":" + statement_text;
+}
+
+//! Collects the tables the plan scans, returns false if it reads data whose changes we cannot track
+static bool PlanCanBeCached(const PhysicalOperator &op, vector<reference<DuckTableEntry>> &tables) {
+	if (op.type == PhysicalOperatorType::TABLE_SCAN) {
+		// table functions (e.g., file readers or scans of registered data frames) read data we cannot track
+		auto &scan = op.Cast<PhysicalTableScan>();
+		if (scan.function.name != "seq_scan" || !scan.bind_data) {
+			return false;
+		}
+		tables.push_back(scan.bind_data->Cast<TableScanBindData>().table);
+	} else if (op.type == PhysicalOperatorType::INDEX_JOIN) {
+		tables.push_back(op.Cast<PhysicalIndexJoin>().table);
+	}
+	for (auto &child : op.GetChildren()) {
+		if (!PlanCanBeCached(child.get(), tables)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static StatementProperties::CatalogIdentity GetCatalogIdentity(ClientContext &context,
+                                                              optional_ptr<AttachedDatabase> database) {
+	if (!database) {
+		// the catalog is not attached
+		return StatementProperties::CatalogIdentity {DConstants::INVALID_INDEX, optional_idx()};
+	}
+	Transaction::Get(context, *database);
+	auto &catalog = database->GetCatalog();
+	auto version = catalog.GetCatalogVersion(context);
+	if (database->IsTemporary() && version.IsValid() && version.GetIndex() == 0) {
+		// every connection has its own temporary catalog, they are only interchangeable if nothing was ever created
+		return StatementProperties::CatalogIdentity {0, version};
+	}
+	return StatementProperties::CatalogIdentity {catalog.GetOid(), version};
+}
+
+//! The identities of the catalogs in the search path: a new entry in any of them can shadow the tables the plan reads
+static vector<pair<string, StatementProperties::CatalogIdentity>> GetSearchPathIdentities(ClientContext &context) {
+	vector<pair<string, StatementProperties::CatalogIdentity>> result;
+	auto &db_manager = DatabaseManager::Get(context);
+	case_insensitive_set_t catalog_names;
+	for (auto &path : ClientData::Get(context).catalog_search_path->Get()) {
+		auto catalog_name = path.catalog;
+		if (catalog_name == INVALID_CATALOG) {
+			catalog_name = DatabaseManager::GetDefaultDatabase(context);
+		}
+		if (!catalog_names.insert(catalog_name).second) {
+			continue;
+		}
+		result.emplace_back(catalog_name, GetCatalogIdentity(context, db_manager.GetDatabase(context, catalog_name)));
+	}
+	return result;
+}
+
+bool PlanCache::IsValid(ClientContext &context, const CachedPlan &plan) {
+	auto &db_manager = DatabaseManager::Get(context);
+	for (auto &it : plan.prepared->properties.read_databases) {
+		auto database = db_manager.GetDatabase(context, it.first);
+		if (!database || GetCatalogIdentity(context, database) != it.second) {
+			// the catalog has changed (DDL)
+			return false;
+		}
+	}
+	for (auto &it : plan.search_path_identities) {
+		auto database = db_manager.GetDatabase(context, it.first);
+		if (GetCatalogIdentity(context, database) != it.second) {
+			// a catalog in the search path has changed, its entries might shadow the ones the plan was bound to
+			return false;
+		}
+	}
+	for (auto &table_version : plan.table_versions) {
+		if (table_version.first->GetLastChangeCommit() != table_version.second) {
+			// the data of the table has changed: the plan might rely on outdated statistics
+			return false;
+		}
+	}
+	return true;
+}
+
+shared_ptr<PreparedStatementData> PlanCache::Lookup(ClientContext &context, const string &key) {
+	if (key.empty()) {
+		return nullptr;
+	}
+	lock_guard<mutex> guard(lock);
+	auto entry = cache.find(key);
+	if (entry == cache.end()) {
+		return nullptr;
+	}
+	auto &plan = entry->second;
+	if (plan.prepared.use_count() > 1) {
+		// the operators of a plan hold the state of its execution: it can only be used by one query at a time
+		return nullptr;
+	}
+	if (!IsValid(context, plan)) {
+		cache.erase(entry);
+		return nullptr;
+	}
+	plan.last_used = ++use_counter;
+	plan.hits++;
+	return plan.prepared;
+}
+
+vector<PlanCacheEntryInformation> PlanCache::GetEntries() {
+	vector<PlanCacheEntryInformation> result;
+	lock_guard<mutex> guard(lock);
+	for (auto &entry : cache) {
+		// the key is the settings hash followed by the statement text
+		auto &key = entry.first;
+		PlanCacheEntryInformation info;
+		info.query = key.substr(key.find(':') + 1);
+		info.hits = entry.second.hits;
+		result.push_back(std::move(info));
+	}
+	return result;
+}
+
+void PlanCache::Insert(ClientContext &context, const string &key, const shared_ptr<PreparedStatementData> &prepared) {
+	if (key.empty() || !prepared->plan) {
+		return;
+	}
+	auto &properties = prepared->properties;
+	if (!properties.bound_all_parameters || properties.parameter_count > 0 || properties.always_require_rebind ||
+	    !properties.IsReadOnly()) {
+		return;
+	}
+	vector<reference<DuckTableEntry>> tables;
+	if (!PlanCanBeCached(*prepared->plan, tables)) {
+		return;
+	}
+	CachedPlan plan;
+	auto &db_manager = DatabaseManager::Get(context);
+	for (auto &it : properties.read_databases) {
+		if (!it.second.catalog_version.IsValid()) {
+			return;
+		}
+		auto database = db_manager.GetDatabase(context, it.first);
+		if (!database || !database->GetTransactionManager().IsDuckTransactionManager()) {
+			return;
+		}
+		if (database->IsTemporary()) {
+			// the temporary catalog belongs to this connection, and is gone once it disconnects
+			return;
+		}
+	}
+	for (auto &table : tables) {
+		auto &info = table.get().GetStorage().GetDataTableInfo();
+		auto &transaction = DuckTransaction::Get(context, info->GetDB());
+		auto last_change = info->GetLastChangeCommit();
+		if (last_change >= transaction.start_time) {
+			// changes were committed after the transaction started - the plan might have seen them in statistics
+			return;
+		}
+		plan.table_versions.emplace_back(info, last_change);
+	}
+	plan.search_path_identities = GetSearchPathIdentities(context);
+	plan.prepared = prepared;
+
+	lock_guard<mutex> guard(lock);
+	auto max_entries = GetMaxEntries();
+	while (!cache.empty() && cache.size() >= max_entries) {
+		// evict the least recently used plan
+		auto evict = cache.begin();
+		for (auto it = cache.begin(); it != cache.end(); it++) {
+			if (it->second.last_used < evict->second.last_used) {
+				evict = it;
+			}
+		}
+		cache.erase(evict);
+	}
+	plan.last_used = ++use_counter;
+	prepared->plan_cached = true;
+	cache[key] = std::move(plan);
+}
+
+void PlanCache::ResetOperatorStates(PhysicalOperator &op) {
+	op.op_state.reset();
+	op.sink_state.reset();
+	for (auto &child : op.GetChildren()) {
+		ResetOperatorStates(const_cast<PhysicalOperator &>(child.get()));
+	}
+}
+
+} // namespace duckdb
@@ -125,6 +125,7 @@ bool QueryProfiler::OperatorRequiresProfiling(PhysicalOperatorType op_type) {
 	case PhysicalOperatorType::UNNEST:
 	case PhysicalOperatorType::UNGROUPED_AGGREGATE:
 	case PhysicalOperatorType::HASH_GROUP_BY:
+	case PhysicalOperatorType::STREAMING_AGGREGATE:
 	case PhysicalOperatorType::FILTER:
 	case PhysicalOperatorType::PROJECTION:
 	case PhysicalOperatorType::COPY_TO_FILE:
@@ -138,6 +139,7 @@ bool QueryProfiler::OperatorRequiresProfiling(PhysicalOperatorType op_type) {
 	case PhysicalOperatorType::CROSS_PRODUCT:
 	case PhysicalOperatorType::PIECEWISE_MERGE_JOIN:
 	case PhysicalOperatorType::IE_JOIN:
+	case PhysicalOperatorType::INDEX_JOIN:
 	case PhysicalOperatorType::LEFT_DELIM_JOIN:
 	case PhysicalOperatorType::RIGHT_DELIM_JOIN:
 	case PhysicalOperatorType::UNION:
@@ -410,6 +412,17 @@ void OperatorProfiler::Flush(const PhysicalOperator &phys_op) {
 	operator_timing.name = phys_op.GetName();
 }
 
+void QueryProfiler::AddOperatorCopy(const PhysicalOperator &copy, const PhysicalOperator &op) {
+	lock_guard<mutex> guard(flush_lock);
+	if (!IsEnabled() || !running) {
+		return;
+	}
+	auto entry = tree_map.find(op);
+	if (entry != tree_map.end()) {
+		tree_map.insert(make_pair(reference<const PhysicalOperator>(copy), entry->second));
+	}
+}
+
 void QueryProfiler::Flush(OperatorProfiler &profiler) {
 	lock_guard<mutex> guard(flush_lock);
 	if (!IsEnabled() || !running) {
@@ -418,7 +431,10 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 	for (auto &node : profiler.timings) {
 		auto &op = node.first.get();
 		auto entry = tree_map.find(op);
-		D_ASSERT(entry != tree_map.end());
+		if (entry == tree_map.end()) {
+			// an operator that was added while executing (e.g. to restore the layout of re-ordered joins)
+			continue;
+		}
 
 		auto &tree_node = entry->second.get();
 		auto &info = tree_node.GetProfilingInfo();
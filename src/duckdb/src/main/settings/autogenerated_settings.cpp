@@ -241,6 +241,22 @@ Value CatalogErrorMaxSchemasSetting::GetSetting(const ClientContext &context) {
 	return Value::UBIGINT(config.options.catalog_error_max_schemas);
 }
 
+//===----------------------------------------------------------------------===//
+// Checkpoint In Background
+//===----------------------------------------------------------------------===//
+void CheckpointInBackgroundSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.checkpoint_in_background = input.GetValue<bool>();
+}
+
+void CheckpointInBackgroundSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.checkpoint_in_background = DBConfig().options.checkpoint_in_background;
+}
+
+Value CheckpointInBackgroundSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.checkpoint_in_background);
+}
+
 //===----------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===----------------------------------------------------------------------===//
@@ -392,6 +408,23 @@ void DefaultOrderSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
 	config.options.default_order_type = DBConfig().options.default_order_type;
 }
 
+//===----------------------------------------------------------------------===//
+// Enable Adaptive Join Order
+//===----------------------------------------------------------------------===//
+void EnableAdaptiveJoinOrderSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.enable_adaptive_join_order = input.GetValue<bool>();
+}
+
+void EnableAdaptiveJoinOrderSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_adaptive_join_order = ClientConfig().enable_adaptive_join_order;
+}
+
+Value EnableAdaptiveJoinOrderSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::BOOLEAN(config.enable_adaptive_join_order);
+}
+
 //===----------------------------------------------------------------------===//
 // Enable External Access
 //===----------------------------------------------------------------------===//
@@ -414,6 +447,23 @@ Value EnableExternalAccessSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.enable_external_access);
 }
 
+//===----------------------------------------------------------------------===//
+// Enable File Index
+//===----------------------------------------------------------------------===//
+void EnableFileIndexSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.enable_file_index = input.GetValue<bool>();
+}
+
+void EnableFileIndexSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_file_index = ClientConfig().enable_file_index;
+}
+
+Value EnableFileIndexSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::BOOLEAN(config.enable_file_index);
+}
+
 //===----------------------------------------------------------------------===//
 // Enable F S S T Vectors
 //===----------------------------------------------------------------------===//
@@ -607,6 +657,23 @@ Value ExternalThreadsSetting::GetSetting(const ClientContext &context) {
 	return Value::UBIGINT(config.options.external_threads);
 }
 
+//===----------------------------------------------------------------------===//
+// File Index Check Changes
+//===----------------------------------------------------------------------===//
+void FileIndexCheckChangesSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.file_index_check_changes = input.GetValue<bool>();
+}
+
+void FileIndexCheckChangesSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).file_index_check_changes = ClientConfig().file_index_check_changes;
+}
+
+Value FileIndexCheckChangesSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::BOOLEAN(config.file_index_check_changes);
+}
+
 //===----------------------------------------------------------------------===//
 // Home Directory
 //===----------------------------------------------------------------------===//
@@ -717,6 +784,23 @@ Value ImmediateTransactionModeSetting::GetSetting(const ClientContext &context)
 	return Value::BOOLEAN(config.options.immediate_transaction_mode);
 }
 
+//===----------------------------------------------------------------------===//
+// Index Join Threshold
+//===----------------------------------------------------------------------===//
+void IndexJoinThresholdSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.index_join_threshold = input.GetValue<idx_t>();
+}
+
+void IndexJoinThresholdSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).index_join_threshold = ClientConfig().index_join_threshold;
+}
+
+Value IndexJoinThresholdSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::UBIGINT(config.index_join_threshold);
+}
+
 //===----------------------------------------------------------------------===//
 // Index Scan Max Count
 //===----------------------------------------------------------------------===//
@@ -981,6 +1065,22 @@ Value PivotLimitSetting::GetSetting(const ClientContext &context) {
 	return Value::UBIGINT(config.pivot_limit);
 }
 
+//===----------------------------------------------------------------------===//
+// Plan Cache Size
+//===----------------------------------------------------------------------===//
+void PlanCacheSizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.plan_cache_size = input.GetValue<idx_t>();
+}
+
+void PlanCacheSizeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.plan_cache_size = DBConfig().options.plan_cache_size;
+}
+
+Value PlanCacheSizeSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.plan_cache_size);
+}
+
 //===----------------------------------------------------------------------===//
 // Prefer Range Joins
 //===----------------------------------------------------------------------===//
@@ -1065,4 +1165,53 @@ Value ScalarSubqueryErrorOnMultipleRowsSetting::GetSetting(const ClientContext &
 	return Value::BOOLEAN(config.scalar_subquery_error_on_multiple_rows);
 }
 
+//===----------------------------------------------------------------------===//
+// Wal Commit Delay
+//===----------------------------------------------------------------------===//
+void WalCommitDelaySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_commit_delay = input.GetValue<idx_t>();
+}
+
+void WalCommitDelaySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_commit_delay = DBConfig().options.wal_commit_delay;
+}
+
+Value WalCommitDelaySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.wal_commit_delay);
+}
+
+//===----------------------------------------------------------------------===//
+// Wal Commit Mode
+//===----------------------------------------------------------------------===//
+void WalCommitModeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto str_input = StringUtil::Upper(input.GetValue<string>());
+	config.options.wal_commit_mode = EnumUtil::FromString<WALCommitMode>(str_input);
+}
+
+void WalCommitModeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_commit_mode = DBConfig().options.wal_commit_mode;
+}
+
+Value WalCommitModeSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::Lower(EnumUtil::ToString(config.options.wal_commit_mode)));
+}
+
+//===----------------------------------------------------------------------===//
+// Wal Relaxed Sync Interval
+//===----------------------------------------------------------------------===//
+void WalRelaxedSyncIntervalSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_relaxed_sync_interval = input.GetValue<idx_t>();
+}
+
+void WalRelaxedSyncIntervalSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_relaxed_sync_interval = DBConfig().options.wal_relaxed_sync_interval;
+}
+
+Value WalRelaxedSyncIntervalSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.wal_relaxed_sync_interval);
+}
+
 } // namespace duckdb
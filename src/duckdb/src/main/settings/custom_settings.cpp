@@ -27,6 +27,7 @@
 #include "duckdb/planner/expression_binder.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/object_cache.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
 namespace duckdb {
@@ -923,6 +924,38 @@ Value MaxTempDirectorySizeSetting::GetSetting(const ClientContext &context) {
 	}
 }
 
+//===----------------------------------------------------------------------===//
+// Object Cache Memory Limit
+//===----------------------------------------------------------------------===//
+void ObjectCacheMemoryLimitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto limit = DBConfig::ParseMemoryLimit(input.ToString());
+	if (limit == DConstants::INVALID_INDEX) {
+		// We use INVALID_INDEX to indicate that the value is not set by the user
+		// use one lower to indicate 'unlimited'
+		limit--;
+	}
+	config.options.object_cache_memory_limit = limit;
+	if (db) {
+		db->GetObjectCache().EvictToLimit();
+	}
+}
+
+void ObjectCacheMemoryLimitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.object_cache_memory_limit = DBConfig().options.object_cache_memory_limit;
+	if (db) {
+		db->GetObjectCache().EvictToLimit();
+	}
+}
+
+Value ObjectCacheMemoryLimitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	if (config.options.object_cache_memory_limit != DConstants::INVALID_INDEX) {
+		return Value(StringUtil::BytesToHumanReadableString(config.options.object_cache_memory_limit));
+	}
+	auto &buffer_pool = BufferManager::GetBufferManager(context).GetBufferPool();
+	return Value(StringUtil::BytesToHumanReadableString(buffer_pool.GetMaxMemory() / 10));
+}
+
 //===----------------------------------------------------------------------===//
 // Ordered Aggregate Threshold
 //===----------------------------------------------------------------------===//
@@ -15,7 +15,8 @@
 namespace duckdb {
 
 CMChildInfo::CMChildInfo(LogicalOperator &op, const column_binding_set_t &referenced_bindings)
-    : bindings_before(op.GetColumnBindings()), types(op.types), can_compress(bindings_before.size(), true) {
+    : bindings_before(op.GetColumnBindings()), types(op.types), can_compress(bindings_before.size(), true),
+      is_payload(bindings_before.size(), false) {
 	for (const auto &binding : referenced_bindings) {
 		for (idx_t binding_idx = 0; binding_idx < bindings_before.size(); binding_idx++) {
 			if (binding == bindings_before[binding_idx]) {
@@ -58,8 +59,20 @@ void CompressedMaterialization::GetReferencedBindings(const Expression &expressi
 	}
 }
 
+void CompressedMaterialization::SetPayloadBindings(CompressedMaterializationInfo &info,
+                                                   const column_binding_set_t &key_bindings) {
+	for (auto &child_info : info.child_info) {
+		for (idx_t binding_idx = 0; binding_idx < child_info.bindings_before.size(); binding_idx++) {
+			const auto &binding = child_info.bindings_before[binding_idx];
+			child_info.is_payload[binding_idx] =
+			    child_info.can_compress[binding_idx] && key_bindings.find(binding) == key_bindings.end();
+		}
+	}
+}
+
 void CompressedMaterialization::UpdateBindingInfo(CompressedMaterializationInfo &info, const ColumnBinding &binding,
-                                                  bool needs_decompression) {
+                                                  bool needs_decompression,
+                                                  shared_ptr<CMStringDictionary> dictionary) {
 	auto &binding_map = info.binding_map;
 	auto binding_it = binding_map.find(binding);
 	if (binding_it == binding_map.end()) {
@@ -68,6 +81,7 @@ void CompressedMaterialization::UpdateBindingInfo(CompressedMaterializationInfo
 
 	auto &binding_info = binding_it->second;
 	binding_info.needs_decompression = needs_decompression;
+	binding_info.dictionary = std::move(dictionary);
 	auto stats_it = statistics_map.find(binding);
 	if (stats_it != statistics_map.end()) {
 		binding_info.stats = statistics_map[binding]->ToUnique();
@@ -138,9 +152,12 @@ bool CompressedMaterialization::TryCompressChild(CompressedMaterializationInfo &
 		const auto child_binding = child_info.bindings_before[child_i];
 		const auto &child_type = child_info.types[child_i];
 		const auto &can_compress = child_info.can_compress[child_i];
-		auto compress_expr = GetCompressExpression(child_binding, child_type, can_compress);
+		const auto &is_payload = child_info.is_payload[child_i];
+		auto compress_expr = GetCompressExpression(child_binding, child_type, can_compress, is_payload);
+		shared_ptr<CMStringDictionary> dictionary;
 		bool compressed = false;
 		if (compress_expr) { // We compressed, mark the outgoing binding in need of decompression
+			dictionary = compress_expr->dictionary;
 			compress_exprs.emplace_back(std::move(compress_expr));
 			compressed = true;
 		} else { // We did not compress, just push a colref
@@ -149,7 +166,7 @@ bool CompressedMaterialization::TryCompressChild(CompressedMaterializationInfo &
 			unique_ptr<BaseStatistics> colref_stats = it != statistics_map.end() ? it->second->ToUnique() : nullptr;
 			compress_exprs.emplace_back(make_uniq<CompressExpression>(std::move(colref_expr), std::move(colref_stats)));
 		}
-		UpdateBindingInfo(info, child_binding, compressed);
+		UpdateBindingInfo(info, child_binding, compressed, std::move(dictionary));
 		compressed_anything = compressed_anything || compressed;
 	}
 	if (!compressed_anything) {
@@ -250,7 +267,11 @@ void CompressedMaterialization::CreateDecompressProjection(unique_ptr<LogicalOpe
 				continue;
 			}
 			stats = binding_info.stats.get();
-			if (binding_info.needs_decompression) {
+			if (binding_info.dictionary) {
+				auto &dictionary = binding_info.dictionary;
+				decompress_expr =
+				    GetStringDictionaryDecompress(std::move(decompress_expr), binding_info.type, dictionary);
+			} else if (binding_info.needs_decompression) {
 				decompress_expr = GetDecompressExpression(std::move(decompress_expr), binding_info.type, *stats);
 			}
 		}
@@ -302,12 +323,25 @@ void CompressedMaterialization::CreateDecompressProjection(unique_ptr<LogicalOpe
 
 unique_ptr<CompressExpression> CompressedMaterialization::GetCompressExpression(const ColumnBinding &binding,
                                                                                 const LogicalType &type,
-                                                                                const bool &can_compress) {
+                                                                                const bool &can_compress,
+                                                                                const bool &is_payload) {
 	auto it = statistics_map.find(binding);
 	if (can_compress && it != statistics_map.end() && it->second) {
 		auto input = make_uniq<BoundColumnRefExpression>(type, binding);
 		const auto &stats = *it->second;
-		return GetCompressExpression(std::move(input), stats);
+		auto compress_expr = GetCompressExpression(input->Copy(), stats);
+		if (!is_payload || type.id() != LogicalTypeId::VARCHAR) {
+			return compress_expr;
+		}
+		// Payload strings do not have to preserve order: Prefer a dictionary over a compressed type that is larger
+		if (!compress_expr || GetTypeIdSize(compress_expr->expression->return_type.InternalType()) >
+		                          GetTypeIdSize(PhysicalType::UINT32)) {
+			auto dictionary_expr = GetStringDictionaryCompress(std::move(input), stats);
+			if (dictionary_expr) {
+				return dictionary_expr;
+			}
+		}
+		return compress_expr;
 	}
 	return nullptr;
 }
@@ -448,6 +482,29 @@ unique_ptr<CompressExpression> CompressedMaterialization::GetStringCompress(uniq
 	return make_uniq<CompressExpression>(std::move(compress_expr), compress_stats.ToUnique());
 }
 
+unique_ptr<CompressExpression> CompressedMaterialization::GetStringDictionaryCompress(unique_ptr<Expression> input,
+                                                                                      const BaseStatistics &stats) {
+	const auto distinct_count = stats.GetDistinctCount();
+	if (distinct_count == 0 || distinct_count > DICTIONARY_CARDINALITY_THRESHOLD) {
+		return nullptr;
+	}
+
+	// The compress and decompress functions share the dictionary, which is filled during execution
+	auto dictionary = make_shared_ptr<CMStringDictionary>();
+	auto compress_function = CMStringDictionaryCompressFun::GetFunction();
+	vector<unique_ptr<Expression>> arguments;
+	arguments.emplace_back(std::move(input));
+	auto compress_expr = make_uniq<BoundFunctionExpression>(LogicalType::UINTEGER, compress_function,
+	                                                        std::move(arguments),
+	                                                        make_uniq<CMStringDictionaryData>(dictionary));
+
+	auto compress_stats = NumericStats::CreateUnknown(LogicalType::UINTEGER);
+	compress_stats.CopyBase(stats);
+	auto result = make_uniq<CompressExpression>(std::move(compress_expr), compress_stats.ToUnique());
+	result->dictionary = std::move(dictionary);
+	return result;
+}
+
 unique_ptr<Expression> CompressedMaterialization::GetDecompressExpression(unique_ptr<Expression> input,
                                                                           const LogicalType &result_type,
                                                                           const BaseStatistics &stats) {
@@ -482,4 +539,14 @@ unique_ptr<Expression> CompressedMaterialization::GetStringDecompress(unique_ptr
 	return make_uniq<BoundFunctionExpression>(result_type, decompress_function, std::move(arguments), nullptr);
 }
 
+unique_ptr<Expression>
+CompressedMaterialization::GetStringDictionaryDecompress(unique_ptr<Expression> input, const LogicalType &result_type,
+                                                         shared_ptr<CMStringDictionary> dictionary) {
+	auto decompress_function = CMStringDictionaryDecompressFun::GetFunction();
+	vector<unique_ptr<Expression>> arguments;
+	arguments.emplace_back(std::move(input));
+	return make_uniq<BoundFunctionExpression>(result_type, decompress_function, std::move(arguments),
+	                                          make_uniq<CMStringDictionaryData>(std::move(dictionary)));
+}
+
 } // namespace duckdb
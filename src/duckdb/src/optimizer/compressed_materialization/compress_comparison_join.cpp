@@ -101,6 +101,14 @@ void CompressedMaterialization::CompressComparisonJoin(unique_ptr<LogicalOperato
 	// Create info for compression
 	CompressedMaterializationInfo info(*op, {0, 1}, referenced_bindings);
 
+	// The bindings in the join conditions are keys, the other bindings of the build side are payload
+	column_binding_set_t key_bindings;
+	for (const auto &condition : join.conditions) {
+		GetReferencedBindings(*condition.left, key_bindings);
+		GetReferencedBindings(*condition.right, key_bindings);
+	}
+	SetPayloadBindings(info, key_bindings);
+
 	const auto bindings_out = join.GetColumnBindings();
 	const auto &types = join.types;
 	PopulateBindingMap(info, bindings_out, types, left_child);
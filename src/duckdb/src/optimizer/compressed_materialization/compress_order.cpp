@@ -25,6 +25,13 @@ void CompressedMaterialization::CompressOrder(unique_ptr<LogicalOperator> &op) {
 	// Create info for compression
 	CompressedMaterializationInfo info(*op, {0}, referenced_bindings);
 
+	// The bindings in the order nodes are keys, the other bindings are payload
+	column_binding_set_t key_bindings;
+	for (auto &bound_order : order.orders) {
+		GetReferencedBindings(*bound_order.expression, key_bindings);
+	}
+	SetPayloadBindings(info, key_bindings);
+
 	// Create binding mapping
 	const auto bindings = order.GetColumnBindings();
 	const auto &types = order.types;
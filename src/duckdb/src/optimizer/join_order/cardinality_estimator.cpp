@@ -1,11 +1,14 @@
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/enums/join_type.hpp"
 #include "duckdb/common/limits.hpp"
+#include "duckdb/common/map.hpp"
 #include "duckdb/common/printer.hpp"
 #include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/optimizer/join_order/join_node.hpp"
 #include "duckdb/optimizer/join_order/query_graph_manager.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/storage/data_table.hpp"
 
@@ -126,6 +129,177 @@ void CardinalityEstimator::RemoveEmptyTotalDomains() {
 	relations_to_tdoms.erase(remove_start, relations_to_tdoms.end());
 }
 
+//! Counts the pairs of rows of the two samples with equal (non-NULL) keys
+static idx_t CountSampleMatches(DataChunk &left, const vector<idx_t> &left_columns, DataChunk &right,
+                                const vector<idx_t> &right_columns) {
+	struct SampleKey {
+		vector<Value> values;
+		idx_t count;
+	};
+	auto get_key = [](DataChunk &chunk, const vector<idx_t> &columns, idx_t row, vector<Value> &key, hash_t &hash) {
+		key.clear();
+		hash = 0;
+		for (auto &column : columns) {
+			auto value = chunk.GetValue(column, row);
+			if (value.IsNull()) {
+				// NULL keys do not join
+				return false;
+			}
+			hash = CombineHash(hash, value.Hash());
+			key.push_back(std::move(value));
+		}
+		return true;
+	};
+	auto keys_equal = [](const vector<Value> &a, const vector<Value> &b) {
+		for (idx_t i = 0; i < a.size(); i++) {
+			if (!Value::NotDistinctFrom(a[i], b[i])) {
+				return false;
+			}
+		}
+		return true;
+	};
+
+	// count the distinct keys of the right sample
+	unordered_map<hash_t, vector<SampleKey>> right_keys;
+	vector<Value> key;
+	hash_t hash;
+	for (idx_t row = 0; row < right.size(); row++) {
+		if (!get_key(right, right_columns, row, key, hash)) {
+			continue;
+		}
+		auto &entries = right_keys[hash];
+		bool found = false;
+		for (auto &entry : entries) {
+			if (keys_equal(entry.values, key)) {
+				entry.count++;
+				found = true;
+				break;
+			}
+		}
+		if (!found) {
+			entries.push_back(SampleKey {key, 1});
+		}
+	}
+	// probe with the keys of the left sample
+	idx_t matches = 0;
+	for (idx_t row = 0; row < left.size(); row++) {
+		if (!get_key(left, left_columns, row, key, hash)) {
+			continue;
+		}
+		auto entry = right_keys.find(hash);
+		if (entry == right_keys.end()) {
+			continue;
+		}
+		for (auto &right_key : entry->second) {
+			if (keys_equal(right_key.values, key)) {
+				matches += right_key.count;
+				break;
+			}
+		}
+	}
+	return matches;
+}
+
+void CardinalityEstimator::InitSampledJoinSelectivities(ClientContext &context,
+                                                        const vector<unique_ptr<FilterInfo>> &filter_infos,
+                                                        const vector<RelationStats> &relation_stats) {
+	struct SampledJoin {
+		vector<idx_t> filter_indexes;
+		vector<idx_t> left_columns;
+		vector<idx_t> right_columns;
+	};
+	// collect the equality conditions between the columns of pairs of base tables
+	map<pair<idx_t, idx_t>, SampledJoin> joins;
+	for (auto &filter_info : filter_infos) {
+		if (!filter_info->filter || filter_info->join_type != JoinType::INNER || !filter_info->left_set ||
+		    !filter_info->right_set || filter_info->left_set->count != 1 || filter_info->right_set->count != 1) {
+			continue;
+		}
+		auto &filter = *filter_info->filter;
+		if (filter.GetExpressionClass() != ExpressionClass::BOUND_COMPARISON ||
+		    filter.type != ExpressionType::COMPARE_EQUAL) {
+			continue;
+		}
+		auto &comparison = filter.Cast<BoundComparisonExpression>();
+		if (comparison.left->type != ExpressionType::BOUND_COLUMN_REF ||
+		    comparison.right->type != ExpressionType::BOUND_COLUMN_REF ||
+		    comparison.left->return_type != comparison.right->return_type) {
+			continue;
+		}
+		auto left_relation = filter_info->left_binding.table_index;
+		auto left_column = filter_info->left_binding.column_index;
+		auto right_relation = filter_info->right_binding.table_index;
+		auto right_column = filter_info->right_binding.column_index;
+		if (left_relation == right_relation || left_relation >= relation_stats.size() ||
+		    right_relation >= relation_stats.size()) {
+			continue;
+		}
+		auto left_scan = relation_stats[left_relation].table_scan;
+		auto right_scan = relation_stats[right_relation].table_scan;
+		if (!left_scan || !right_scan || left_column >= left_scan->GetColumnIds().size() ||
+		    right_column >= right_scan->GetColumnIds().size()) {
+			continue;
+		}
+		if (left_relation > right_relation) {
+			std::swap(left_relation, right_relation);
+			std::swap(left_column, right_column);
+		}
+		auto &join = joins[make_pair(left_relation, right_relation)];
+		join.filter_indexes.push_back(filter_info->filter_index);
+		join.left_columns.push_back(left_column);
+		join.right_columns.push_back(right_column);
+	}
+	if (joins.empty()) {
+		return;
+	}
+
+	// fetch the samples of the join columns of every relation
+	map<idx_t, vector<idx_t>> relation_columns;
+	auto sample_column = [&](idx_t relation, idx_t column) {
+		auto &columns = relation_columns[relation];
+		for (idx_t i = 0; i < columns.size(); i++) {
+			if (columns[i] == column) {
+				return i;
+			}
+		}
+		columns.push_back(column);
+		return columns.size() - 1;
+	};
+	for (auto &entry : joins) {
+		for (auto &column : entry.second.left_columns) {
+			column = sample_column(entry.first.first, column);
+		}
+		for (auto &column : entry.second.right_columns) {
+			column = sample_column(entry.first.second, column);
+		}
+	}
+	unordered_map<idx_t, unique_ptr<DataChunk>> samples;
+	for (auto &entry : relation_columns) {
+		auto table_scan = relation_stats[entry.first].table_scan;
+		samples[entry.first] = RelationStatisticsHelper::ExtractGetSample(*table_scan, context, entry.second);
+	}
+
+	// join the samples: all equality conditions between two tables are evaluated together
+	for (auto &entry : joins) {
+		auto &left_sample = samples[entry.first.first];
+		auto &right_sample = samples[entry.first.second];
+		if (!left_sample || !right_sample || left_sample->size() == 0 || right_sample->size() == 0) {
+			continue;
+		}
+		auto &join = entry.second;
+		auto matches = CountSampleMatches(*left_sample, join.left_columns, *right_sample, join.right_columns);
+		if (matches < MINIMUM_SAMPLED_JOIN_MATCHES) {
+			// too few matches to be accurate
+			continue;
+		}
+		auto sample_pairs = static_cast<double>(left_sample->size()) * static_cast<double>(right_sample->size());
+		auto denominator = sample_pairs / static_cast<double>(matches);
+		for (auto &filter_index : join.filter_indexes) {
+			sampled_denominators[filter_index] = denominator;
+		}
+	}
+}
+
 double CardinalityEstimator::GetNumerator(JoinRelationSet &set) {
 	double numerator = 1;
 	for (idx_t i = 0; i < set.count; i++) {
@@ -235,10 +409,16 @@ double CardinalityEstimator::CalculateUpdatedDenom(Subgraph2Denominator left, Su
 		double extra_ratio = 1;
 		switch (comparison_type) {
 		case ExpressionType::COMPARE_EQUAL:
-		case ExpressionType::COMPARE_NOT_DISTINCT_FROM:
+		case ExpressionType::COMPARE_NOT_DISTINCT_FROM: {
 			// extra ration stays 1
 			extra_ratio = filter.has_tdom_hll ? (double)filter.tdom_hll : (double)filter.tdom_no_hll;
+			auto sampled_denominator = sampled_denominators.find(filter.filter_info->filter_index);
+			if (sampled_denominator != sampled_denominators.end()) {
+				// the selectivity of the join between the samples of the tables
+				extra_ratio = sampled_denominator->second;
+			}
 			break;
+		}
 		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
 		case ExpressionType::COMPARE_LESSTHAN:
 		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
@@ -451,6 +451,8 @@ void PlanEnumerator::InitLeafPlans() {
 	auto relation_stats = query_graph_manager.relation_manager.GetRelationStats();
 
 	cost_model.cardinality_estimator.InitEquivalentRelations(query_graph_manager.GetFilterBindings());
+	cost_model.cardinality_estimator.InitSampledJoinSelectivities(
+	    query_graph_manager.context, query_graph_manager.GetFilterBindings(), relation_stats);
 	cost_model.cardinality_estimator.AddRelationNamesToTdoms(relation_stats);
 
 	// then update the total domains based on the cardinalities of each relation.
@@ -280,6 +280,8 @@ bool RelationManager::ExtractJoinRelations(JoinOrderOptimizer &optimizer, Logica
 			child_stats.cardinality = LossyNumericCast<idx_t>(static_cast<double>(child_stats.cardinality) *
 			                                                  RelationStatisticsHelper::DEFAULT_SELECTIVITY);
 		}
+		// the rows of the unnest (and its filters) are not the rows of a sample of the table it reads from
+		child_stats.table_scan = nullptr;
 		ModifyStatsIfLimit(limit_op.get(), child_stats);
 		AddRelation(input_op, parent, child_stats);
 		return true;
@@ -347,6 +349,10 @@ bool RelationManager::ExtractJoinRelations(JoinOrderOptimizer &optimizer, Logica
 			stats.cardinality =
 			    (idx_t)MaxValue(double(stats.cardinality) * RelationStatisticsHelper::DEFAULT_SELECTIVITY, (double)1);
 		}
+		if (!datasource_filters.empty() || limit_op) {
+			// the sample of the table does not reflect these filters
+			stats.table_scan = nullptr;
+		}
 		ModifyStatsIfLimit(limit_op.get(), stats);
 		AddRelation(input_op, parent, stats);
 		return true;
@@ -8,6 +8,8 @@
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/transaction/local_storage.hpp"
 
 namespace duckdb {
 
@@ -137,10 +139,69 @@ RelationStats RelationStatisticsHelper::ExtractGetStats(LogicalGet &get, ClientC
 	get.estimated_cardinality = cardinality_after_filters;
 	get.has_estimated_cardinality = true;
 	D_ASSERT(base_table_cardinality >= cardinality_after_filters);
+	if (catalog_table && catalog_table->IsDuckTable() && get.function.name == "seq_scan") {
+		return_stats.table_scan = get;
+	}
 	return_stats.stats_initialized = true;
 	return return_stats;
 }
 
+unique_ptr<DataChunk> RelationStatisticsHelper::ExtractGetSample(LogicalGet &get, ClientContext &context,
+                                                                 const vector<idx_t> &columns) {
+	auto table = get.GetTable();
+	if (!table || !table->IsDuckTable()) {
+		return nullptr;
+	}
+	auto &storage = table->GetStorage();
+	if (LocalStorage::Get(context, table->catalog).Find(storage)) {
+		// the sample does not contain the transaction-local data
+		return nullptr;
+	}
+	// the sample contains the requested columns, followed by the columns that are filtered on
+	auto &column_ids = get.GetColumnIds();
+	vector<column_t> sample_columns;
+	unordered_map<idx_t, idx_t> sample_column_map;
+	auto add_column = [&](idx_t column_idx) {
+		if (sample_column_map.find(column_idx) != sample_column_map.end()) {
+			return;
+		}
+		sample_column_map[column_idx] = sample_columns.size();
+		sample_columns.push_back(column_ids[column_idx].GetPrimaryIndex());
+	};
+	for (auto &column_idx : columns) {
+		D_ASSERT(column_idx < column_ids.size());
+		add_column(column_idx);
+	}
+	for (auto &entry : get.table_filters.filters) {
+		add_column(entry.first);
+	}
+	auto sample = storage.GetSample(context, sample_columns);
+	if (!sample || get.table_filters.filters.empty()) {
+		return sample;
+	}
+	try {
+		auto conjunction = make_uniq<BoundConjunctionExpression>(ExpressionType::CONJUNCTION_AND);
+		for (auto &entry : get.table_filters.filters) {
+			auto sample_idx = sample_column_map[entry.first];
+			BoundReferenceExpression column(sample->data[sample_idx].GetType(), sample_idx);
+			conjunction->children.push_back(entry.second->ToExpression(column));
+		}
+		unique_ptr<Expression> filter;
+		if (conjunction->children.size() == 1) {
+			filter = std::move(conjunction->children[0]);
+		} else {
+			filter = std::move(conjunction);
+		}
+		ExpressionExecutor executor(context, *filter);
+		SelectionVector sel(STANDARD_VECTOR_SIZE);
+		auto count = executor.SelectExpression(*sample, sel);
+		sample->Slice(sel, count);
+	} catch (std::exception &) {
+		return nullptr;
+	}
+	return sample;
+}
+
 RelationStats RelationStatisticsHelper::ExtractDelimGetStats(LogicalDelimGet &delim_get, ClientContext &context) {
 	RelationStats stats;
 	stats.table_name = delim_get.GetName();
@@ -1,12 +1,17 @@
 #include "duckdb/optimizer/topn_optimizer.hpp"
 
 #include "duckdb/common/limits.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
 
+TopN::TopN(ClientContext &context_p) : context(context_p) {
+}
+
 bool TopN::CanOptimize(LogicalOperator &op) {
 	if (op.type == LogicalOperatorType::LOGICAL_LIMIT) {
 		auto &limit = op.Cast<LogicalLimit>();
@@ -32,6 +37,19 @@ bool TopN::CanOptimize(LogicalOperator &op) {
 	return false;
 }
 
+void TopN::PushdownIndexScan(LogicalTopN &topn) {
+	if (topn.orders.size() != 1 || topn.limit > NumericLimits<idx_t>::Maximum() - topn.offset) {
+		return;
+	}
+	auto &child = *topn.children[0];
+	if (child.type != LogicalOperatorType::LOGICAL_GET) {
+		return;
+	}
+	// the TopN stays in place: it orders the (small) set of candidate rows fetched through the index
+	auto &get = child.Cast<LogicalGet>();
+	TableScanFunction::PushdownTopN(context, get, topn.orders[0], topn.limit + topn.offset);
+}
+
 unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 	if (CanOptimize(*op)) {
 
@@ -67,6 +85,7 @@ unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 			cardinality = topn->children[0]->estimated_cardinality;
 		}
 		topn->SetEstimatedCardinality(cardinality);
+		PushdownIndexScan(*topn);
 		op = std::move(topn);
 
 		// reconstruct all projection nodes above limit operator
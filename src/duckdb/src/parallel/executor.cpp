@@ -232,7 +232,9 @@ void Executor::ScheduleEventsInternal(ScheduleEventData &event_data) {
 			}
 			auto &child1_base = *child1->GetBasePipeline();
 			auto child1_entry = event_map.find(child1_base);
-			D_ASSERT(child1_entry != event_map.end());
+			if (child1_entry == event_map.end()) {
+				continue; // Not rescheduled, e.g., a join build that is reused by a recursive CTE
+			}
 
 			for (auto &child2 : children) {
 				if (child2->Type() != MetaPipelineType::JOIN_BUILD || RefersToSameObject(*child1, *child2)) {
@@ -244,7 +246,9 @@ void Executor::ScheduleEventsInternal(ScheduleEventData &event_data) {
 
 				auto &child2_base = *child2->GetBasePipeline();
 				auto child2_entry = event_map.find(child2_base);
-				D_ASSERT(child2_entry != event_map.end());
+				if (child2_entry == event_map.end()) {
+					continue; // Not rescheduled
+				}
 
 				// all children PrepareFinalize must wait until all Combine
 				child1_entry->second.pipeline_prepare_finish_event.AddDependency(child2_entry->second.pipeline_event);
@@ -3,6 +3,7 @@
 #include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/printer.hpp"
 #include "duckdb/common/tree_renderer/text_tree_renderer.hpp"
+#include "duckdb/execution/adaptive_join_order.hpp"
 #include "duckdb/execution/executor.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
@@ -208,6 +209,8 @@ void Pipeline::PrepareFinalize() {
 }
 
 void Pipeline::Reset() {
+	// the build sides of the joins in this pipeline are known now: re-order the probes if they were misestimated
+	AdaptiveJoinOrder::ReorderProbes(*this);
 	ResetSink();
 	for (auto &op_ref : operators) {
 		auto &op = op_ref.get();
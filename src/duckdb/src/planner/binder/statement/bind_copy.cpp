@@ -56,6 +56,7 @@ BoundStatement Binder::BindCopyTo(CopyStatement &stmt, CopyToType copy_to_type)
 	bool seen_overwrite_mode = false;
 	bool seen_filepattern = false;
 	bool write_partition_columns = false;
+	bool file_index = false;
 	CopyFunctionReturnType return_type = CopyFunctionReturnType::CHANGED_ROWS;
 
 	CopyFunctionBindInput bind_input(*stmt.info);
@@ -123,6 +124,8 @@ BoundStatement Binder::BindCopyTo(CopyStatement &stmt, CopyToType copy_to_type)
 			}
 		} else if (loption == "write_partition_columns") {
 			write_partition_columns = true;
+		} else if (loption == "file_index") {
+			file_index = GetBooleanArg(context, option.second);
 		} else {
 			stmt.info->options[option.first] = option.second;
 		}
@@ -142,9 +145,6 @@ BoundStatement Binder::BindCopyTo(CopyStatement &stmt, CopyToType copy_to_type)
 	if (per_thread_output && !partition_cols.empty()) {
 		throw NotImplementedException("Can't combine PER_THREAD_OUTPUT and PARTITION_BY for COPY");
 	}
-	if (file_size_bytes.IsValid() && !partition_cols.empty()) {
-		throw NotImplementedException("Can't combine FILE_SIZE_BYTES and PARTITION_BY for COPY");
-	}
 	if (!write_partition_columns) {
 		if (partition_cols.size() == select_node.names.size()) {
 			throw NotImplementedException("No column to write as all columns are specified as partition columns. "
@@ -217,9 +217,14 @@ BoundStatement Binder::BindCopyTo(CopyStatement &stmt, CopyToType copy_to_type)
 			throw NotImplementedException(
 			    "Can't combine USE_TMP_FILE and file rotation (e.g., ROW_GROUPS_PER_FILE) for COPY");
 		}
-		if (!partition_cols.empty()) {
-			throw NotImplementedException(
-			    "Can't combine file rotation (e.g., ROW_GROUPS_PER_FILE) and PARTITION_BY for COPY");
+	}
+	if (file_index) {
+		if (partition_cols.empty() && !per_thread_output && !rotate) {
+			throw NotImplementedException("FILE_INDEX requires writing a directory of files (e.g., with PARTITION_BY, "
+			                              "PER_THREAD_OUTPUT or FILE_SIZE_BYTES) for COPY");
+		}
+		if (!copy_function.function.copy_from_function.statistics) {
+			throw NotImplementedException("FILE_INDEX is not supported for FORMAT \"%s\"", stmt.info->format);
 		}
 	}
 
@@ -237,6 +242,7 @@ BoundStatement Binder::BindCopyTo(CopyStatement &stmt, CopyToType copy_to_type)
 	copy->rotate = rotate;
 	copy->partition_output = !partition_cols.empty();
 	copy->write_partition_columns = write_partition_columns;
+	copy->file_index = file_index;
 	copy->partition_columns = std::move(partition_cols);
 	copy->return_type = return_type;
 
@@ -291,14 +291,51 @@ BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_me
                                                    unique_ptr<FileBuffer> *buffer) {
 	for (auto &queue : queues) {
 		auto block_result = EvictBlocksInternal(*queue, tag, extra_memory, memory_limit, buffer);
-		if (block_result.success || RefersToSameObject(*queue, *queues.back())) {
-			return block_result; // Return upon success or upon last queue
+		if (block_result.success) {
+			return block_result;
+		}
+		if (RefersToSameObject(*queue, *queues.back())) {
+			// unloading blocks was not enough: let the consumers outside of the queues release memory and retry
+			if (!ReleaseConsumerMemory(extra_memory, memory_limit)) {
+				return block_result;
+			}
+			return EvictBlocksInternal(*queue, tag, extra_memory, memory_limit, buffer);
 		}
 	}
 	// This can never happen since we always return when i == 1. Exception to silence compiler warning
 	throw InternalException("Exited BufferPool::EvictBlocksInternal without obtaining BufferPool::EvictionResult");
 }
 
+bool BufferPool::ReleaseConsumerMemory(idx_t extra_memory, idx_t memory_limit) {
+	lock_guard<mutex> guard(consumer_lock);
+	bool released = false;
+	for (auto &consumer : consumers) {
+		auto required_memory = memory_usage.GetUsedMemory(MemoryUsageCaches::NO_FLUSH) + extra_memory;
+		if (required_memory <= memory_limit) {
+			break;
+		}
+		if (consumer.get().ReleaseMemory(required_memory - memory_limit) > 0) {
+			released = true;
+		}
+	}
+	return released;
+}
+
+void BufferPool::RegisterConsumer(EvictableMemoryConsumer &consumer) {
+	lock_guard<mutex> guard(consumer_lock);
+	consumers.push_back(consumer);
+}
+
+void BufferPool::UnregisterConsumer(EvictableMemoryConsumer &consumer) {
+	lock_guard<mutex> guard(consumer_lock);
+	for (idx_t i = 0; i < consumers.size(); i++) {
+		if (RefersToSameObject(consumers[i].get(), consumer)) {
+			consumers.erase_at(i);
+			return;
+		}
+	}
+}
+
 BufferPool::EvictionResult BufferPool::EvictBlocksInternal(EvictionQueue &queue, MemoryTag tag, idx_t extra_memory,
                                                            idx_t memory_limit, unique_ptr<FileBuffer> *buffer) {
 	TempBufferPoolReservation r(tag, *this, extra_memory);
@@ -0,0 +1,561 @@
+#include "duckdb/common/random_engine.hpp"
+#include "duckdb/common/types/vector_buffer.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/checkpoint/string_checkpoint_state.hpp"
+#include "duckdb/storage/checkpoint/write_overflow_strings_to_disk.hpp"
+#include "duckdb/storage/string_uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+
+#include "zstd.h"
+
+namespace duckdb {
+
+// ZSTD compression stores strings in independently compressed frames of at most one vector's worth of rows.
+// A frame is decompressed as a whole, so scans only decompress the frames they touch.
+//
+// Segment layout:
+// | frame_count | directory entry (frame_count times) | compressed frames |
+// Directory entry:
+// | row_end | frame_offset | compressed_size | uncompressed_size |
+// Uncompressed frame:
+// | string lengths (row count times) | string data |
+// Frames that compress to more than the frame size limit (i.e., frames of a single large string) are stored in
+// overflow blocks, like large strings of uncompressed segments. The segment then only stores a marker for the frame.
+typedef struct {
+	//! The (segment-relative) row index one past the last row of the frame
+	uint32_t row_end;
+	//! The offset of the compressed frame (relative to the start of the segment)
+	uint32_t frame_offset;
+	uint32_t compressed_size;
+	uint32_t uncompressed_size;
+} zstd_frame_entry_t;
+
+struct ZSTDStorage {
+	static constexpr double MINIMUM_COMPRESSION_RATIO = 1.2;
+	static constexpr double ANALYSIS_SAMPLE_SIZE = 0.25;
+	static constexpr int COMPRESSION_LEVEL = 3;
+	static constexpr idx_t HEADER_SIZE = sizeof(uint32_t);
+
+	static unique_ptr<AnalyzeState> StringInitAnalyze(ColumnData &col_data, PhysicalType type);
+	static bool StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count);
+	static idx_t StringFinalAnalyze(AnalyzeState &state_p);
+
+	static unique_ptr<CompressionState> InitCompression(ColumnDataCheckpointer &checkpointer,
+	                                                    unique_ptr<AnalyzeState> analyze_state_p);
+	static void Compress(CompressionState &state_p, Vector &scan_vector, idx_t count);
+	static void FinalizeCompress(CompressionState &state_p);
+
+	static unique_ptr<SegmentScanState> StringInitScan(ColumnSegment &segment);
+	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                              idx_t result_offset);
+	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+	                           idx_t result_idx);
+
+	//! The maximum uncompressed size of a frame - frames are closed early when they reach this size
+	static idx_t GetFrameSizeLimit(idx_t block_size) {
+		return block_size / 4;
+	}
+	static idx_t GetDirectoryOffset(idx_t frame_idx) {
+		return HEADER_SIZE + frame_idx * sizeof(zstd_frame_entry_t);
+	}
+	//! Whether a frame is stored in overflow blocks instead of in the segment
+	static bool IsOverflowFrame(idx_t compressed_size, idx_t block_size) {
+		return compressed_size > GetFrameSizeLimit(block_size);
+	}
+	//! The size that a frame takes up in the segment
+	static idx_t GetStoredSize(idx_t compressed_size, idx_t block_size) {
+		if (IsOverflowFrame(compressed_size, block_size)) {
+			return UncompressedStringStorage::BIG_STRING_MARKER_SIZE;
+		}
+		return compressed_size;
+	}
+	//! ZSTD segments are only written when the storage only has to be readable by this build
+	static bool IsEnabled(const DBConfig &config) {
+		return config.options.serialization_compatibility.duckdb_version == "latest";
+	}
+	static zstd_frame_entry_t GetFrameEntry(data_ptr_t base_ptr, idx_t frame_idx);
+	//! Returns the index of the frame that contains the given (segment-relative) row
+	static idx_t FindFrame(data_ptr_t base_ptr, idx_t row);
+	static void DecompressFrame(ColumnSegment &segment, data_ptr_t base_ptr, const zstd_frame_entry_t &entry,
+	                            data_ptr_t target);
+	static void DecompressFrame(const_data_ptr_t source, const zstd_frame_entry_t &entry, data_ptr_t target);
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+struct ZSTDAnalyzeState : public AnalyzeState {
+	explicit ZSTDAnalyzeState(const CompressionInfo &info) : AnalyzeState(info) {
+	}
+
+	idx_t count = 0;
+	//! The total size of all frames before compression
+	idx_t total_size = 0;
+	//! The sizes of the sampled frames before and after compression
+	idx_t sample_size = 0;
+	idx_t sample_compressed_size = 0;
+
+	RandomEngine random_engine;
+	vector<data_t> frame_buffer;
+	vector<data_t> compress_buffer;
+};
+
+unique_ptr<AnalyzeState> ZSTDStorage::StringInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	auto &config = DBConfig::GetConfig(col_data.GetDatabase());
+	if (!IsEnabled(config)) {
+		// the storage we write has to remain readable by versions that do not know about ZSTD segments
+		return nullptr;
+	}
+	CompressionInfo info(col_data.GetBlockManager().GetBlockSize());
+	return make_uniq<ZSTDAnalyzeState>(info);
+}
+
+bool ZSTDStorage::StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+
+	idx_t string_size = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		string_size += data[idx].GetSize();
+	}
+	auto frame_size = count * sizeof(uint32_t) + string_size;
+	state.count += count;
+	state.total_size += frame_size;
+
+	if (string_size == 0 || (state.sample_size > 0 && state.random_engine.NextRandom() >= ANALYSIS_SAMPLE_SIZE)) {
+		return true;
+	}
+	// compress the vector as a frame to estimate the compression ratio
+	state.frame_buffer.resize(frame_size);
+	auto lengths = reinterpret_cast<uint32_t *>(state.frame_buffer.data());
+	auto string_ptr = state.frame_buffer.data() + count * sizeof(uint32_t);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			lengths[i] = 0;
+			continue;
+		}
+		auto size = data[idx].GetSize();
+		lengths[i] = UnsafeNumericCast<uint32_t>(size);
+		memcpy(string_ptr, data[idx].GetData(), size);
+		string_ptr += size;
+	}
+	state.compress_buffer.resize(duckdb_zstd::ZSTD_compressBound(frame_size));
+	auto compressed_size =
+	    duckdb_zstd::ZSTD_compress(state.compress_buffer.data(), state.compress_buffer.size(),
+	                               state.frame_buffer.data(), frame_size, COMPRESSION_LEVEL);
+	if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+		return false;
+	}
+	state.sample_size += frame_size;
+	state.sample_compressed_size += compressed_size;
+	return true;
+}
+
+idx_t ZSTDStorage::StringFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	if (state.sample_size == 0) {
+		// only NULLs and empty strings: other methods handle these better
+		return DConstants::INVALID_INDEX;
+	}
+	auto compression_ratio = double(state.sample_compressed_size) / double(state.sample_size);
+	auto estimated_data_size = double(state.total_size) * compression_ratio;
+
+	auto frame_size_limit = GetFrameSizeLimit(state.info.GetBlockSize());
+	auto frame_count = MaxValue<idx_t>((state.count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE,
+	                                   (state.total_size + frame_size_limit - 1) / frame_size_limit);
+	auto estimated_size = estimated_data_size + double(frame_count * sizeof(zstd_frame_entry_t));
+	auto segment_count = estimated_size / double(state.info.GetBlockSize());
+	estimated_size += segment_count * double(HEADER_SIZE);
+
+	return LossyNumericCast<idx_t>(estimated_size * MINIMUM_COMPRESSION_RATIO);
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+class ZSTDCompressionState : public CompressionState {
+public:
+	ZSTDCompressionState(ColumnDataCheckpointer &checkpointer, const CompressionInfo &info)
+	    : CompressionState(info), checkpointer(checkpointer),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_ZSTD)),
+	      frame_size_limit(ZSTDStorage::GetFrameSizeLimit(info.GetBlockSize())) {
+		CreateEmptySegment(checkpointer.GetRowStart());
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		current_segment =
+		    ColumnSegment::CreateTransientSegment(db, type, row_start, info.GetBlockSize(), info.GetBlockSize());
+		current_segment->function = function;
+		// frames that do not fit in a segment are written to overflow blocks
+		auto &state = current_segment->GetSegmentState()->Cast<UncompressedStringSegmentState>();
+		state.overflow_writer =
+		    make_uniq<WriteOverflowStringsToDisk>(checkpointer.GetCheckpointState().GetPartialBlockManager());
+		frame_entries.clear();
+		frame_data.clear();
+	}
+
+	void Append(UnifiedVectorFormat &vdata, idx_t count) {
+		auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			bool is_valid = vdata.validity.RowIsValid(idx);
+			auto size = is_valid ? data[idx].GetSize() : 0;
+			auto required_size = (frame_validity.size() + 1) * sizeof(uint32_t) + frame_strings.size() + size;
+			if (frame_validity.size() == STANDARD_VECTOR_SIZE ||
+			    (!frame_validity.empty() && required_size > frame_size_limit)) {
+				FlushFrame();
+			}
+			frame_validity.push_back(is_valid);
+			frame_lengths.push_back(UnsafeNumericCast<uint32_t>(size));
+			if (size > 0) {
+				auto str_ptr = const_data_ptr_cast(data[idx].GetData());
+				frame_strings.insert(frame_strings.end(), str_ptr, str_ptr + size);
+			}
+		}
+	}
+
+	//! Compresses the rows gathered so far into a frame and adds it to the current segment
+	void FlushFrame() {
+		auto row_count = frame_validity.size();
+		if (row_count == 0) {
+			return;
+		}
+		auto lengths_size = row_count * sizeof(uint32_t);
+		auto frame_size = lengths_size + frame_strings.size();
+		uncompressed_buffer.resize(frame_size);
+		memcpy(uncompressed_buffer.data(), frame_lengths.data(), lengths_size);
+		if (!frame_strings.empty()) {
+			memcpy(uncompressed_buffer.data() + lengths_size, frame_strings.data(), frame_strings.size());
+		}
+		compress_buffer.resize(duckdb_zstd::ZSTD_compressBound(frame_size));
+		auto compressed_size =
+		    duckdb_zstd::ZSTD_compress(compress_buffer.data(), compress_buffer.size(), uncompressed_buffer.data(),
+		                               frame_size, ZSTDStorage::COMPRESSION_LEVEL);
+		if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+			throw InternalException("ZSTD string compression failed: %s",
+			                        duckdb_zstd::ZSTD_getErrorName(compressed_size));
+		}
+
+		auto stored_size = ZSTDStorage::GetStoredSize(compressed_size, info.GetBlockSize());
+		if (GetSegmentSize(frame_entries.size() + 1, frame_data.size() + stored_size) > info.GetBlockSize()) {
+			FlushSegment();
+			if (GetSegmentSize(1, stored_size) > info.GetBlockSize()) {
+				throw InternalException("ZSTD string compression failed due to insufficient space in empty block");
+			}
+		}
+
+		// update the statistics of the segment with the strings of this frame
+		auto string_ptr = frame_strings.data();
+		for (idx_t i = 0; i < row_count; i++) {
+			if (!frame_validity[i]) {
+				continue;
+			}
+			auto length = frame_lengths[i];
+			UncompressedStringStorage::UpdateStringStats(current_segment->stats,
+			                                             string_t(const_char_ptr_cast(string_ptr), length));
+			string_ptr += length;
+		}
+		current_segment->count += row_count;
+
+		zstd_frame_entry_t entry;
+		entry.row_end = UnsafeNumericCast<uint32_t>(current_segment->count.load());
+		entry.frame_offset = 0; // assigned when the segment is written
+		entry.compressed_size = UnsafeNumericCast<uint32_t>(compressed_size);
+		entry.uncompressed_size = UnsafeNumericCast<uint32_t>(frame_size);
+		frame_entries.push_back(entry);
+		if (ZSTDStorage::IsOverflowFrame(compressed_size, info.GetBlockSize())) {
+			// write the frame to overflow blocks, and store the marker that points to it in the segment
+			block_id_t block_id;
+			int32_t offset;
+			string_t frame(const_char_ptr_cast(compress_buffer.data()), UnsafeNumericCast<uint32_t>(compressed_size));
+			UncompressedStringStorage::WriteString(*current_segment, frame, block_id, offset);
+			data_t marker[UncompressedStringStorage::BIG_STRING_MARKER_SIZE];
+			UncompressedStringStorage::WriteStringMarker(marker, block_id, offset);
+			frame_data.insert(frame_data.end(), marker, marker + UncompressedStringStorage::BIG_STRING_MARKER_SIZE);
+		} else {
+			frame_data.insert(frame_data.end(), compress_buffer.data(), compress_buffer.data() + compressed_size);
+		}
+
+		frame_validity.clear();
+		frame_lengths.clear();
+		frame_strings.clear();
+	}
+
+	static idx_t GetSegmentSize(idx_t frame_count, idx_t data_size) {
+		return ZSTDStorage::GetDirectoryOffset(frame_count) + data_size;
+	}
+
+	void FlushSegment(bool final = false) {
+		auto next_start = current_segment->start + current_segment->count;
+
+		auto &buffer_manager = BufferManager::GetBufferManager(checkpointer.GetDatabase());
+		auto handle = buffer_manager.Pin(current_segment->block);
+		auto base_ptr = handle.Ptr();
+		auto frame_count = frame_entries.size();
+		auto data_offset = ZSTDStorage::GetDirectoryOffset(frame_count);
+		auto segment_size = GetSegmentSize(frame_count, frame_data.size());
+		D_ASSERT(segment_size <= info.GetBlockSize());
+
+		Store<uint32_t>(UnsafeNumericCast<uint32_t>(frame_count), base_ptr);
+		auto frame_offset = data_offset;
+		for (idx_t i = 0; i < frame_count; i++) {
+			auto &entry = frame_entries[i];
+			entry.frame_offset = UnsafeNumericCast<uint32_t>(frame_offset);
+			auto entry_ptr = base_ptr + ZSTDStorage::GetDirectoryOffset(i);
+			Store<uint32_t>(entry.row_end, entry_ptr);
+			Store<uint32_t>(entry.frame_offset, entry_ptr + sizeof(uint32_t));
+			Store<uint32_t>(entry.compressed_size, entry_ptr + 2 * sizeof(uint32_t));
+			Store<uint32_t>(entry.uncompressed_size, entry_ptr + 3 * sizeof(uint32_t));
+			frame_offset += ZSTDStorage::GetStoredSize(entry.compressed_size, info.GetBlockSize());
+		}
+		if (!frame_data.empty()) {
+			memcpy(base_ptr + data_offset, frame_data.data(), frame_data.size());
+		}
+
+		auto &segment_state = current_segment->GetSegmentState()->Cast<UncompressedStringSegmentState>();
+		segment_state.overflow_writer->Flush();
+		segment_state.overflow_writer.reset();
+
+		auto &state = checkpointer.GetCheckpointState();
+		state.FlushSegment(std::move(current_segment), std::move(handle), segment_size);
+		if (!final) {
+			CreateEmptySegment(next_start);
+		}
+	}
+
+	void Finalize() {
+		FlushFrame();
+		FlushSegment(true);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+	const idx_t frame_size_limit;
+
+	// The segment that is being filled, and the frames that have been compressed into it so far
+	unique_ptr<ColumnSegment> current_segment;
+	vector<zstd_frame_entry_t> frame_entries;
+	vector<data_t> frame_data;
+
+	// The rows of the frame that is being gathered
+	vector<bool> frame_validity;
+	vector<uint32_t> frame_lengths;
+	vector<data_t> frame_strings;
+
+	vector<data_t> uncompressed_buffer;
+	vector<data_t> compress_buffer;
+};
+
+unique_ptr<CompressionState> ZSTDStorage::InitCompression(ColumnDataCheckpointer &checkpointer,
+                                                          unique_ptr<AnalyzeState> analyze_state_p) {
+	return make_uniq<ZSTDCompressionState>(checkpointer, analyze_state_p->info);
+}
+
+void ZSTDStorage::Compress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	state.Append(vdata, count);
+}
+
+void ZSTDStorage::FinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+struct ZSTDScanState : public SegmentScanState {
+	BufferHandle handle;
+	//! The frame that is currently decompressed, and the rows it covers
+	idx_t frame_idx = DConstants::INVALID_INDEX;
+	idx_t frame_row_start = 0;
+	idx_t frame_row_end = 0;
+	//! The decompressed frame - shared with the result vectors that point into it
+	buffer_ptr<VectorBuffer> frame_buffer;
+	//! The offsets of the strings within the decompressed frame
+	vector<uint32_t> string_offsets;
+
+	void LoadFrame(ColumnSegment &segment, data_ptr_t base_ptr, idx_t row) {
+		if (frame_idx != DConstants::INVALID_INDEX && row >= frame_row_start && row < frame_row_end) {
+			return;
+		}
+		frame_idx = ZSTDStorage::FindFrame(base_ptr, row);
+		auto entry = ZSTDStorage::GetFrameEntry(base_ptr, frame_idx);
+		frame_row_start = frame_idx == 0 ? 0 : ZSTDStorage::GetFrameEntry(base_ptr, frame_idx - 1).row_end;
+		frame_row_end = entry.row_end;
+
+		// result vectors might still reference the previous frame: decompress into a fresh buffer
+		frame_buffer = make_buffer<VectorBuffer>(entry.uncompressed_size);
+		ZSTDStorage::DecompressFrame(segment, base_ptr, entry, frame_buffer->GetData());
+
+		auto row_count = frame_row_end - frame_row_start;
+		auto lengths = reinterpret_cast<uint32_t *>(frame_buffer->GetData());
+		string_offsets.resize(row_count);
+		uint32_t offset = UnsafeNumericCast<uint32_t>(row_count * sizeof(uint32_t));
+		for (idx_t i = 0; i < row_count; i++) {
+			string_offsets[i] = offset;
+			offset += Load<uint32_t>(data_ptr_cast(lengths + i));
+		}
+		D_ASSERT(offset == entry.uncompressed_size);
+	}
+};
+
+unique_ptr<SegmentScanState> ZSTDStorage::StringInitScan(ColumnSegment &segment) {
+	auto state = make_uniq<ZSTDScanState>();
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	state->handle = buffer_manager.Pin(segment.block);
+	return std::move(state);
+}
+
+void ZSTDStorage::StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                    idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<ZSTDScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+	auto base_ptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto result_data = FlatVector::GetData<string_t>(result);
+
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		auto row = start + scanned;
+		scan_state.LoadFrame(segment, base_ptr, row);
+		auto frame_ptr = scan_state.frame_buffer->GetData();
+		auto lengths = reinterpret_cast<uint32_t *>(frame_ptr);
+		auto to_scan = MinValue<idx_t>(scan_count - scanned, scan_state.frame_row_end - row);
+		for (idx_t i = 0; i < to_scan; i++) {
+			auto frame_row = row + i - scan_state.frame_row_start;
+			auto length = Load<uint32_t>(data_ptr_cast(lengths + frame_row));
+			auto str_ptr = const_char_ptr_cast(frame_ptr + scan_state.string_offsets[frame_row]);
+			result_data[result_offset + scanned + i] = string_t(str_ptr, length);
+		}
+		// the non-inlined strings point into the decompressed frame: keep it alive with the result
+		StringVector::AddBuffer(result, scan_state.frame_buffer);
+		scanned += to_scan;
+	}
+}
+
+void ZSTDStorage::StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	StringScanPartial(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+void ZSTDStorage::StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                                 idx_t result_idx) {
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	auto handle = buffer_manager.Pin(segment.block);
+	auto base_ptr = handle.Ptr() + segment.GetBlockOffset();
+
+	auto row = UnsafeNumericCast<idx_t>(row_id);
+	auto frame_idx = FindFrame(base_ptr, row);
+	auto entry = GetFrameEntry(base_ptr, frame_idx);
+	auto frame_row_start = frame_idx == 0 ? 0 : GetFrameEntry(base_ptr, frame_idx - 1).row_end;
+
+	auto frame_buffer = make_unsafe_uniq_array_uninitialized<data_t>(entry.uncompressed_size);
+	DecompressFrame(segment, base_ptr, entry, frame_buffer.get());
+
+	auto frame_row = row - frame_row_start;
+	auto row_count = entry.row_end - frame_row_start;
+	idx_t offset = row_count * sizeof(uint32_t);
+	for (idx_t i = 0; i < frame_row; i++) {
+		offset += Load<uint32_t>(frame_buffer.get() + i * sizeof(uint32_t));
+	}
+	auto length = Load<uint32_t>(frame_buffer.get() + frame_row * sizeof(uint32_t));
+
+	auto result_data = FlatVector::GetData<string_t>(result);
+	result_data[result_idx] =
+	    StringVector::AddStringOrBlob(result, const_char_ptr_cast(frame_buffer.get() + offset), length);
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+CompressionFunction ZSTDFun::GetFunction(PhysicalType data_type) {
+	D_ASSERT(data_type == PhysicalType::VARCHAR);
+	return CompressionFunction(
+	    CompressionType::COMPRESSION_ZSTD, data_type, ZSTDStorage::StringInitAnalyze, ZSTDStorage::StringAnalyze,
+	    ZSTDStorage::StringFinalAnalyze, ZSTDStorage::InitCompression, ZSTDStorage::Compress,
+	    ZSTDStorage::FinalizeCompress, ZSTDStorage::StringInitScan, ZSTDStorage::StringScan,
+	    ZSTDStorage::StringScanPartial, ZSTDStorage::StringFetchRow, UncompressedFunctions::EmptySkip,
+	    UncompressedStringStorage::StringInitSegment, nullptr, nullptr, nullptr, nullptr,
+	    UncompressedStringStorage::SerializeState, UncompressedStringStorage::DeserializeState,
+	    UncompressedStringStorage::CleanupState);
+}
+
+bool ZSTDFun::TypeIsSupported(const PhysicalType physical_type) {
+	return physical_type == PhysicalType::VARCHAR;
+}
+
+//===--------------------------------------------------------------------===//
+// Helper Functions
+//===--------------------------------------------------------------------===//
+zstd_frame_entry_t ZSTDStorage::GetFrameEntry(data_ptr_t base_ptr, idx_t frame_idx) {
+	auto entry_ptr = base_ptr + GetDirectoryOffset(frame_idx);
+	zstd_frame_entry_t entry;
+	entry.row_end = Load<uint32_t>(entry_ptr);
+	entry.frame_offset = Load<uint32_t>(entry_ptr + sizeof(uint32_t));
+	entry.compressed_size = Load<uint32_t>(entry_ptr + 2 * sizeof(uint32_t));
+	entry.uncompressed_size = Load<uint32_t>(entry_ptr + 3 * sizeof(uint32_t));
+	return entry;
+}
+
+idx_t ZSTDStorage::FindFrame(data_ptr_t base_ptr, idx_t row) {
+	idx_t lower = 0;
+	idx_t upper = Load<uint32_t>(base_ptr);
+	// binary search for the first frame that ends after the row
+	while (lower < upper) {
+		auto middle = lower + (upper - lower) / 2;
+		if (Load<uint32_t>(base_ptr + GetDirectoryOffset(middle)) <= row) {
+			lower = middle + 1;
+		} else {
+			upper = middle;
+		}
+	}
+	if (lower == Load<uint32_t>(base_ptr)) {
+		throw InternalException("ZSTD segment does not contain row %llu", row);
+	}
+	return lower;
+}
+
+void ZSTDStorage::DecompressFrame(ColumnSegment &segment, data_ptr_t base_ptr, const zstd_frame_entry_t &entry,
+                                  data_ptr_t target) {
+	auto frame_ptr = base_ptr + entry.frame_offset;
+	if (!IsOverflowFrame(entry.compressed_size, segment.GetBlockManager().GetBlockSize())) {
+		DecompressFrame(frame_ptr, entry, target);
+		return;
+	}
+	// the frame is stored in overflow blocks: the vector keeps the buffer that it is read into alive
+	block_id_t block_id;
+	int32_t offset;
+	UncompressedStringStorage::ReadStringMarker(frame_ptr, block_id, offset);
+	Vector overflow(LogicalType::VARCHAR);
+	auto frame = UncompressedStringStorage::ReadOverflowString(segment, overflow, block_id, offset);
+	D_ASSERT(frame.GetSize() == entry.compressed_size);
+	DecompressFrame(const_data_ptr_cast(frame.GetData()), entry, target);
+}
+
+void ZSTDStorage::DecompressFrame(const_data_ptr_t source, const zstd_frame_entry_t &entry, data_ptr_t target) {
+	auto decompressed_size =
+	    duckdb_zstd::ZSTD_decompress(target, entry.uncompressed_size, source, entry.compressed_size);
+	if (duckdb_zstd::ZSTD_isError(decompressed_size) || decompressed_size != entry.uncompressed_size) {
+		throw IOException("Failed to decompress ZSTD string segment: %s",
+		                  duckdb_zstd::ZSTD_isError(decompressed_size)
+		                      ? duckdb_zstd::ZSTD_getErrorName(decompressed_size)
+		                      : "unexpected decompressed size");
+	}
+}
+
+} // namespace duckdb
@@ -980,6 +980,8 @@ void DataTable::RevertAppendInternal(idx_t start_row) {
 	D_ASSERT(is_root);
 	// revert appends made to row_groups
 	row_groups->RevertAppendInternal(start_row);
+	// the sample might contain the reverted rows
+	info->InvalidateSample();
 }
 
 void DataTable::RevertAppend(DuckTransaction &transaction, idx_t start_row, idx_t count) {
@@ -1399,6 +1401,17 @@ unique_ptr<BaseStatistics> DataTable::GetStatistics(ClientContext &context, colu
 	return row_groups->CopyStats(column_id);
 }
 
+unique_ptr<DataChunk> DataTable::GetSample(ClientContext &context, const vector<column_t> &column_ids) {
+	for (auto &column_id : column_ids) {
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			return nullptr;
+		}
+	}
+	auto &transaction = DuckTransaction::Get(context, db);
+	auto lock = info->checkpoint_lock.GetSharedLock();
+	return row_groups->GetSample(transaction, column_ids);
+}
+
 void DataTable::SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats) {
 	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
 	row_groups->SetDistinct(column_id, std::move(distinct_stats));
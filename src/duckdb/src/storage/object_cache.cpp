@@ -0,0 +1,105 @@
+#include "duckdb/storage/object_cache.hpp"
+
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+ObjectCache::ObjectCache(DatabaseInstance &db)
+    : db(db), buffer_pool(BufferManager::GetBufferManager(db).GetBufferPool()), memory_usage(0) {
+	buffer_pool.RegisterConsumer(*this);
+}
+
+ObjectCache::~ObjectCache() {
+	buffer_pool.UnregisterConsumer(*this);
+	// release the memory we accounted in the (possibly shared) buffer pool
+	if (memory_usage > 0) {
+		buffer_pool.UpdateUsedMemory(MemoryTag::OBJECT_CACHE, -NumericCast<int64_t>(memory_usage));
+	}
+}
+
+void ObjectCache::Touch(CachedObject &entry) {
+	if (entry.memory == 0) {
+		return;
+	}
+	lru.splice(lru.begin(), lru, entry.lru_position);
+}
+
+void ObjectCache::PutInternal(string key, shared_ptr<ObjectCacheEntry> value) {
+	auto existing = cache.find(key);
+	if (existing != cache.end()) {
+		// replace the (possibly stale) existing entry
+		EraseInternal(existing);
+	}
+	CachedObject cached_object;
+	auto estimated_memory = value ? value->GetEstimatedCacheMemory() : optional_idx();
+	if (estimated_memory.IsValid()) {
+		cached_object.memory = MaxValue<idx_t>(estimated_memory.GetIndex(), 1);
+		lru.push_front(key);
+		cached_object.lru_position = lru.begin();
+		memory_usage += cached_object.memory;
+		buffer_pool.UpdateUsedMemory(MemoryTag::OBJECT_CACHE, NumericCast<int64_t>(cached_object.memory));
+	}
+	cached_object.object = std::move(value);
+	cache.insert(make_pair(std::move(key), std::move(cached_object)));
+	if (estimated_memory.IsValid()) {
+		EvictInternal();
+	}
+}
+
+void ObjectCache::EraseInternal(cache_iterator_t entry) {
+	auto &cached_object = entry->second;
+	if (cached_object.memory > 0) {
+		lru.erase(cached_object.lru_position);
+		memory_usage -= cached_object.memory;
+		buffer_pool.UpdateUsedMemory(MemoryTag::OBJECT_CACHE, -NumericCast<int64_t>(cached_object.memory));
+	}
+	cache.erase(entry);
+}
+
+idx_t ObjectCache::GetMemoryLimit() const {
+	auto &config = DBConfig::GetConfig(db);
+	if (config.options.object_cache_memory_limit != DConstants::INVALID_INDEX) {
+		return config.options.object_cache_memory_limit;
+	}
+	// by default the object cache may use up to 10% of the memory limit
+	return buffer_pool.GetMaxMemory() / 10;
+}
+
+void ObjectCache::EvictInternal() {
+	auto limit = GetMemoryLimit();
+	while (!lru.empty() && memory_usage > limit) {
+		auto entry = cache.find(lru.back());
+		D_ASSERT(entry != cache.end());
+		EraseInternal(entry);
+	}
+}
+
+idx_t ObjectCache::ReleaseMemory(idx_t bytes) {
+	// the buffer pool calls this from whichever thread is allocating - which may be one creating a cache entry
+	unique_lock<mutex> glock(lock, std::try_to_lock);
+	if (!glock.owns_lock()) {
+		return 0;
+	}
+	idx_t released = 0;
+	while (!lru.empty() && released < bytes) {
+		auto entry = cache.find(lru.back());
+		D_ASSERT(entry != cache.end());
+		released += entry->second.memory;
+		EraseInternal(entry);
+	}
+	return released;
+}
+
+void ObjectCache::EvictToLimit() {
+	lock_guard<mutex> glock(lock);
+	EvictInternal();
+}
+
+idx_t ObjectCache::GetMemoryUsage() {
+	lock_guard<mutex> glock(lock);
+	return memory_usage;
+}
+
+} // namespace duckdb
@@ -158,7 +158,7 @@ void BaseStatistics::Merge(const BaseStatistics &other) {
 	}
 }
 
-idx_t BaseStatistics::GetDistinctCount() {
+idx_t BaseStatistics::GetDistinctCount() const {
 	return distinct_count;
 }
 
@@ -0,0 +1,154 @@
+#include "duckdb/storage/statistics/table_sample.hpp"
+
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+#include <cmath>
+
+namespace duckdb {
+
+TableSample::TableSample(Allocator &allocator, const vector<LogicalType> &types_p, idx_t sample_size)
+    : allocator(allocator), types(types_p), sample_size(sample_size) {
+	D_ASSERT(sample_size > 0 && sample_size <= STANDARD_VECTOR_SIZE);
+}
+
+void TableSample::InitializeSample(idx_t capacity) {
+	sample.Destroy();
+	sample.Initialize(allocator, types, capacity);
+}
+
+double TableSample::NextRandom() {
+	return 1.0 - random.NextRandom();
+}
+
+void TableSample::NextSampleIndex() {
+	// skip the rows that do not enter the sample
+	auto skip = std::floor(std::log(NextRandom()) / std::log1p(-threshold));
+	if (!(skip < 1e18)) {
+		skip = 1e18;
+	}
+	next_sample_index += static_cast<idx_t>(skip) + 1;
+}
+
+void TableSample::InitializeSkip(double threshold_p) {
+	threshold = MinValue<double>(threshold_p, 1.0 - 1e-12);
+	next_sample_index = rows_seen - 1;
+	NextSampleIndex();
+}
+
+void TableSample::Append(DataChunk &input) {
+	auto input_start = rows_seen;
+	idx_t offset = 0;
+	if (sample.size() < sample_size) {
+		// the sample is not full yet: add the first rows
+		offset = MinValue<idx_t>(sample_size - sample.size(), input.size());
+		if (sample.ColumnCount() == 0) {
+			// the sample grows while it is filled: small tables (or appends) do not allocate the full sample
+			InitializeSample(MinValue<idx_t>(NextPowerOfTwo(MaxValue<idx_t>(offset, 1)), sample_size));
+		}
+		SelectionVector sel(offset);
+		for (idx_t i = 0; i < offset; i++) {
+			sel.set_index(i, i);
+		}
+		sample.Append(input, true, &sel, offset);
+		rows_seen += offset;
+		if (sample.size() < sample_size) {
+			return;
+		}
+		InitializeSkip(std::exp(std::log(NextRandom()) / static_cast<double>(sample_size)));
+	}
+	auto input_end = input_start + input.size();
+	while (next_sample_index < input_end) {
+		// replace a random sample row with this row
+		SelectionVector sel(1);
+		sel.set_index(0, next_sample_index - input_start);
+		auto target = random.NextRandomInteger64() % sample_size;
+		for (idx_t col_idx = 0; col_idx < sample.ColumnCount(); col_idx++) {
+			VectorOperations::Copy(input.data[col_idx], sample.data[col_idx], sel, 1, 0, target);
+		}
+		threshold *= std::exp(std::log(NextRandom()) / static_cast<double>(sample_size));
+		NextSampleIndex();
+	}
+	rows_seen = input_end;
+}
+
+void TableSample::Merge(TableSample &other) {
+	D_ASSERT(types == other.types);
+	if (other.rows_seen == 0) {
+		return;
+	}
+	if (rows_seen == 0) {
+		InitializeSample(sample_size);
+		sample.Append(other.sample);
+		rows_seen = other.rows_seen;
+		threshold = other.threshold;
+		next_sample_index = other.next_sample_index;
+		return;
+	}
+	// both samples are uniform samples of their rows: draw from them in proportion to the amount of rows they saw
+	auto total_rows = rows_seen + other.rows_seen;
+	auto result_size = MinValue<idx_t>(sample_size, total_rows);
+	auto other_count = static_cast<idx_t>(std::round(static_cast<double>(result_size) *
+	                                                  static_cast<double>(other.rows_seen) /
+	                                                  static_cast<double>(total_rows)));
+	other_count = MinValue<idx_t>(other_count, other.sample.size());
+	auto this_count = MinValue<idx_t>(result_size - other_count, sample.size());
+	other_count = MinValue<idx_t>(result_size - this_count, other.sample.size());
+
+	auto select_random = [&](idx_t source_count, idx_t count) {
+		// partial Fisher-Yates shuffle
+		vector<idx_t> indexes(source_count);
+		for (idx_t i = 0; i < source_count; i++) {
+			indexes[i] = i;
+		}
+		SelectionVector sel(MaxValue<idx_t>(count, 1));
+		for (idx_t i = 0; i < count; i++) {
+			auto swap_idx = i + random.NextRandomInteger64() % (source_count - i);
+			std::swap(indexes[i], indexes[swap_idx]);
+			sel.set_index(i, indexes[i]);
+		}
+		return sel;
+	};
+	DataChunk merged;
+	merged.Initialize(allocator, types, sample_size);
+	auto this_sel = select_random(sample.size(), this_count);
+	merged.Append(sample, false, &this_sel, this_count);
+	auto other_sel = select_random(other.sample.size(), other_count);
+	merged.Append(other.sample, false, &other_sel, other_count);
+
+	InitializeSample(sample_size);
+	sample.Append(merged);
+	rows_seen = total_rows;
+	if (sample.size() == sample_size) {
+		// after N rows, the threshold is approximately sample_size / N
+		InitializeSkip(static_cast<double>(sample_size) / static_cast<double>(rows_seen));
+	}
+}
+
+void TableSample::Initialize(DataChunk &rows, idx_t total_rows) {
+	D_ASSERT(rows.size() <= sample_size);
+	InitializeSample(sample_size);
+	sample.Append(rows);
+	rows_seen = MaxValue<idx_t>(total_rows, rows.size());
+	if (sample.size() == sample_size) {
+		InitializeSkip(static_cast<double>(sample_size) / static_cast<double>(rows_seen));
+	}
+}
+
+unique_ptr<DataChunk> TableSample::GetSample(const vector<column_t> &column_ids) const {
+	if (sample.size() == 0) {
+		return nullptr;
+	}
+	vector<LogicalType> result_types;
+	for (auto &column_id : column_ids) {
+		result_types.push_back(types[column_id]);
+	}
+	auto result = make_uniq<DataChunk>();
+	result->Initialize(allocator, result_types, sample_size);
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		VectorOperations::Copy(sample.data[column_ids[i]], result->data[i], sample.size(), 0, 0);
+	}
+	result->SetCardinality(sample.size());
+	return result;
+}
+
+} // namespace duckdb
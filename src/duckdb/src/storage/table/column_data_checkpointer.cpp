@@ -12,13 +12,7 @@ ColumnDataCheckpointer::ColumnDataCheckpointer(ColumnData &col_data_p, RowGroup
     : col_data(col_data_p), row_group(row_group_p), state(state_p),
       is_validity(GetType().id() == LogicalTypeId::VALIDITY),
       intermediate(is_validity ? LogicalType::BOOLEAN : GetType(), true, is_validity),
-      checkpoint_info(checkpoint_info_p) {
-
-	auto &config = DBConfig::GetConfig(GetDatabase());
-	auto functions = config.GetCompressionFunctions(GetType().InternalType());
-	for (auto &func : functions) {
-		compression_functions.push_back(&func.get());
-	}
+      range_start(0), range_end(0), checkpoint_info(checkpoint_info_p) {
 }
 
 DatabaseInstance &ColumnDataCheckpointer::GetDatabase() {
@@ -37,13 +31,18 @@ RowGroup &ColumnDataCheckpointer::GetRowGroup() {
 	return row_group;
 }
 
+idx_t ColumnDataCheckpointer::GetRowStart() const {
+	D_ASSERT(range_start < nodes.size());
+	return nodes[range_start].node->start;
+}
+
 ColumnCheckpointState &ColumnDataCheckpointer::GetCheckpointState() {
 	return state;
 }
 
 void ColumnDataCheckpointer::ScanSegments(const std::function<void(Vector &, idx_t)> &callback) {
 	Vector scan_vector(intermediate.GetType(), nullptr);
-	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
+	for (idx_t segment_idx = range_start; segment_idx < range_end; segment_idx++) {
 		auto &segment = *nodes[segment_idx].node;
 		ColumnScanState scan_state;
 		scan_state.current = &segment;
@@ -96,7 +95,18 @@ CompressionType ForceCompression(vector<optional_ptr<CompressionFunction>> &comp
 	return found ? compression_type : CompressionType::COMPRESSION_AUTO;
 }
 
+void ColumnDataCheckpointer::InitializeCompressionFunctions() {
+	auto &config = DBConfig::GetConfig(GetDatabase());
+	auto functions = config.GetCompressionFunctions(GetType().InternalType());
+	compression_functions.clear();
+	for (auto &func : functions) {
+		compression_functions.push_back(&func.get());
+	}
+}
+
 unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx_t &compression_idx) {
+	// the analyze step prunes compression functions that cannot be used, start from the full set for every range
+	InitializeCompressionFunctions();
 	D_ASSERT(!compression_functions.empty());
 	auto &config = DBConfig::GetConfig(GetDatabase());
 	CompressionType forced_method = CompressionType::COMPRESSION_AUTO;
@@ -174,13 +184,13 @@ unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx
 }
 
 void ColumnDataCheckpointer::WriteToDisk() {
-	// there were changes or transient segments
-	// we need to rewrite the column segments to disk
+	// there were changes or transient segments in the current range
+	// we need to rewrite the column segments in this range to disk
 
 	// first we check the current segments
 	// if there are any persistent segments, we will mark their old block ids as modified
 	// since the segments will be rewritten their old on disk data is no longer required
-	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
+	for (idx_t segment_idx = range_start; segment_idx < range_end; segment_idx++) {
 		auto segment = nodes[segment_idx].node.get();
 		segment->CommitDropSegment();
 	}
@@ -201,32 +211,24 @@ void ColumnDataCheckpointer::WriteToDisk() {
 	ScanSegments(
 	    [&](Vector &scan_vector, idx_t count) { best_function->compress(*compress_state, scan_vector, count); });
 	best_function->compress_finalize(*compress_state);
-
-	nodes.clear();
 }
 
-bool ColumnDataCheckpointer::HasChanges() {
-	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
-		auto segment = nodes[segment_idx].node.get();
-		if (segment->segment_type == ColumnSegmentType::TRANSIENT) {
-			// transient segment: always need to write to disk
-			return true;
-		} else {
-			// persistent segment; check if there were any updates or deletions in this segment
-			idx_t start_row_idx = segment->start - row_group.start;
-			idx_t end_row_idx = start_row_idx + segment->count;
-			if (col_data.updates && col_data.updates->HasUpdates(start_row_idx, end_row_idx)) {
-				return true;
-			}
-		}
+bool ColumnDataCheckpointer::HasChanges(idx_t segment_idx) {
+	auto segment = nodes[segment_idx].node.get();
+	if (segment->segment_type == ColumnSegmentType::TRANSIENT) {
+		// transient segment: always need to write to disk
+		return true;
 	}
-	return false;
+	// persistent segment; check if there were any updates or deletions in this segment
+	idx_t start_row_idx = segment->start - row_group.start;
+	idx_t end_row_idx = start_row_idx + segment->count;
+	return col_data.updates && col_data.updates->HasUpdates(start_row_idx, end_row_idx);
 }
 
 void ColumnDataCheckpointer::WritePersistentSegments() {
-	// all segments are persistent and there are no updates
+	// the segments in the current range are persistent and have no updates
 	// we only need to write the metadata
-	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
+	for (idx_t segment_idx = range_start; segment_idx < range_end; segment_idx++) {
 		auto segment = nodes[segment_idx].node.get();
 		auto pointer = segment->GetDataPointer();
 
@@ -243,14 +245,26 @@ void ColumnDataCheckpointer::WritePersistentSegments() {
 void ColumnDataCheckpointer::Checkpoint(vector<SegmentNode<ColumnSegment>> nodes_p) {
 	D_ASSERT(!nodes_p.empty());
 	this->nodes = std::move(nodes_p);
-	// first check if any of the segments have changes
-	if (!HasChanges()) {
-		// no changes: only need to write the metadata for this column
-		WritePersistentSegments();
-	} else {
-		// there are changes: rewrite the set of columns);
-		WriteToDisk();
+	// split the segments into consecutive ranges that either all have changes or all have no changes
+	// unchanged persistent segments are kept as-is, only the ranges with changes are rewritten
+	// this keeps the checkpoint I/O proportional to the modified data rather than to the size of the column
+	range_start = 0;
+	while (range_start < nodes.size()) {
+		bool has_changes = HasChanges(range_start);
+		range_end = range_start + 1;
+		while (range_end < nodes.size() && HasChanges(range_end) == has_changes) {
+			range_end++;
+		}
+		if (has_changes) {
+			// there are changes: rewrite the segments in this range
+			WriteToDisk();
+		} else {
+			// no changes: only need to write the metadata for these segments
+			WritePersistentSegments();
+		}
+		range_start = range_end;
 	}
+	nodes.clear();
 }
 
 CompressionFunction &ColumnDataCheckpointer::GetCompressionFunction(CompressionType compression_type) {
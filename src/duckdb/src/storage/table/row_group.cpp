@@ -419,6 +419,16 @@ bool RowGroup::CheckZonemap(ScanFilterInfo &filters) {
 			filters.SetFilterAlwaysTrue(i);
 		}
 	}
+	auto adaptive_filter = filters.GetAdaptiveFilter();
+	if (adaptive_filter && adaptive_filter->RequiresStatistics()) {
+		// seed the filter order with the statistics of the first row group we scan
+		for (idx_t i = 0; i < filter_list.size(); i++) {
+			auto &entry = filter_list[i];
+			auto stats = GetColumn(entry.table_column_index).GetStatistics();
+			adaptive_filter->SeedStatistics(i, entry.filter, *stats);
+		}
+		adaptive_filter->FinishSeeding();
+	}
 	return true;
 }
 
@@ -613,8 +623,11 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 					}
 					auto scan_idx = filter.scan_column_index;
 					auto &col_data = GetColumn(filter.table_column_index);
+					auto input_count = approved_tuple_count;
+					adaptive_filter->BeginPredicate(filter_state);
 					col_data.Select(transaction, state.vector_index, state.column_scans[scan_idx],
 					                result.data[scan_idx], sel, approved_tuple_count, filter.filter);
+					adaptive_filter->EndPredicate(filter_state, filter_idx, input_count, approved_tuple_count);
 				}
 				for (auto &table_filter : filter_list) {
 					if (table_filter.IsAlwaysTrue()) {
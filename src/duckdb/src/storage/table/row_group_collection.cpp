@@ -1,6 +1,7 @@
 #include "duckdb/storage/table/row_group_collection.hpp"
 
 #include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/common/unordered_set.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
 #include "duckdb/execution/task_error_manager.hpp"
@@ -111,6 +112,7 @@ void RowGroupCollection::Initialize(PersistentCollectionData &data) {
 
 void RowGroupCollection::InitializeEmpty() {
 	stats.InitializeEmpty(types);
+	stats.InitializeSample(types, info->GetSampleVersion());
 }
 
 void RowGroupCollection::AppendRowGroup(SegmentLock &l, idx_t start_row) {
@@ -356,6 +358,7 @@ bool RowGroupCollection::Append(DataChunk &chunk, TableAppendState &state) {
 	const idx_t row_group_size = GetRowGroupSize();
 	D_ASSERT(chunk.ColumnCount() == types.size());
 	chunk.Verify();
+	stats.UpdateSample(chunk);
 
 	bool new_row_group = false;
 	idx_t total_append_count = chunk.size();
@@ -1196,6 +1199,57 @@ unique_ptr<BaseStatistics> RowGroupCollection::CopyStats(column_t column_id) {
 	return stats.CopyStats(column_id);
 }
 
+unique_ptr<DataChunk> RowGroupCollection::GetSample(TransactionData transaction, const vector<column_t> &column_ids) {
+	auto sample_version = info->GetSampleVersion();
+	auto result = stats.GetSample(column_ids, sample_version);
+	if (result) {
+		return result;
+	}
+	// there is no sample of the rows (e.g., the table was loaded from disk, or rows were deleted or updated)
+	// draw a new sample by fetching random rows
+	auto sample = make_uniq<TableSample>(Allocator::DefaultAllocator(), types);
+	auto total_rows = GetTotalRows();
+	if (total_rows > 0) {
+		idx_t sample_size = STANDARD_VECTOR_SIZE;
+		vector<row_t> row_ids;
+		if (total_rows <= sample_size) {
+			for (idx_t i = 0; i < total_rows; i++) {
+				row_ids.push_back(UnsafeNumericCast<row_t>(row_start + i));
+			}
+		} else {
+			// Floyd's algorithm: select sample_size distinct rows
+			RandomEngine random;
+			unordered_set<idx_t> selected;
+			for (idx_t i = total_rows - sample_size; i < total_rows; i++) {
+				auto row = random.NextRandomInteger64() % (i + 1);
+				if (!selected.insert(row).second) {
+					selected.insert(i);
+				}
+			}
+			for (auto &row : selected) {
+				row_ids.push_back(UnsafeNumericCast<row_t>(row_start + row));
+			}
+			std::sort(row_ids.begin(), row_ids.end());
+		}
+		vector<StorageIndex> column_indexes;
+		for (idx_t i = 0; i < types.size(); i++) {
+			column_indexes.emplace_back(i);
+		}
+		DataChunk rows;
+		rows.Initialize(Allocator::DefaultAllocator(), types);
+		Vector row_identifiers(LogicalType::ROW_TYPE, data_ptr_cast(row_ids.data()));
+		ColumnFetchState fetch_state;
+		Fetch(transaction, rows, column_indexes, row_identifiers, row_ids.size(), fetch_state);
+		// deleted rows are not fetched: scale the amount of rows the sample represents accordingly
+		auto visible_rows = static_cast<double>(total_rows) * static_cast<double>(rows.size()) /
+		                    static_cast<double>(row_ids.size());
+		sample->Initialize(rows, LossyNumericCast<idx_t>(visible_rows));
+	}
+	result = sample->GetSample(column_ids);
+	stats.SetSample(std::move(sample), sample_version);
+	return result;
+}
+
 void RowGroupCollection::SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats) {
 	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
 	auto stats_lock = stats.GetLock();
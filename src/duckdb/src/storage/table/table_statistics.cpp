@@ -76,6 +76,12 @@ void TableStatistics::InitializeAddConstraint(TableStatistics &parent) {
 	}
 }
 
+void TableStatistics::InitializeSample(const vector<LogicalType> &types, idx_t sample_version) {
+	D_ASSERT(!append_sample);
+	append_sample = make_uniq<TableSample>(Allocator::DefaultAllocator(), types);
+	append_sample_version = sample_version;
+}
+
 void TableStatistics::MergeStats(TableStatistics &other) {
 	auto l = GetLock();
 	D_ASSERT(column_stats.size() == other.column_stats.size());
@@ -85,6 +91,14 @@ void TableStatistics::MergeStats(TableStatistics &other) {
 			column_stats[i]->Merge(*other.column_stats[i]);
 		}
 	}
+	if (append_sample) {
+		if (other.append_sample) {
+			append_sample->Merge(*other.append_sample);
+		} else {
+			// the merged rows are not represented in the sample
+			append_sample.reset();
+		}
+	}
 }
 
 void TableStatistics::MergeStats(idx_t i, BaseStatistics &stats) {
@@ -109,6 +123,27 @@ unique_ptr<BaseStatistics> TableStatistics::CopyStats(idx_t i) {
 	return result.ToUnique();
 }
 
+void TableStatistics::UpdateSample(DataChunk &chunk) {
+	lock_guard<mutex> l(*stats_lock);
+	if (append_sample) {
+		append_sample->Append(chunk);
+	}
+}
+
+unique_ptr<DataChunk> TableStatistics::GetSample(const vector<column_t> &column_ids, idx_t sample_version) {
+	lock_guard<mutex> l(*stats_lock);
+	if (!append_sample || append_sample_version != sample_version) {
+		return nullptr;
+	}
+	return append_sample->GetSample(column_ids);
+}
+
+void TableStatistics::SetSample(unique_ptr<TableSample> sample, idx_t sample_version) {
+	lock_guard<mutex> l(*stats_lock);
+	append_sample = std::move(sample);
+	append_sample_version = sample_version;
+}
+
 void TableStatistics::CopyStats(TableStatistics &other) {
 	TableStatisticsLock lock(*stats_lock);
 	CopyStats(lock, other);
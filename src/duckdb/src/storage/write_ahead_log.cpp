@@ -10,7 +10,9 @@
 #include "duckdb/common/checksum.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/parser/constraints/unique_constraint.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
@@ -26,10 +28,12 @@ constexpr uint64_t WAL_VERSION_NUMBER = 2;
 
 WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &wal_path, idx_t wal_size,
                              WALInitState init_state)
-    : database(database), wal_path(wal_path), wal_size(wal_size), init_state(init_state) {
+    : database(database), wal_path(wal_path), wal_size(wal_size), init_state(init_state), flushed_commits(0),
+      last_sync(steady_clock::now()) {
 }
 
 WriteAheadLog::~WriteAheadLog() {
+	StopRelaxedSync();
 }
 
 BufferedFileWriter &WriteAheadLog::Initialize() {
@@ -73,6 +77,7 @@ void WriteAheadLog::Truncate(idx_t size) {
 		wal_size = size;
 		return;
 	}
+	lock_guard<mutex> lock(wal_lock);
 	writer->Truncate(size);
 	wal_size = writer->GetFileSize();
 }
@@ -86,6 +91,7 @@ void WriteAheadLog::Delete() {
 		// no WAL to delete
 		return;
 	}
+	lock_guard<mutex> lock(wal_lock);
 	writer.reset();
 	auto &fs = FileSystem::Get(database);
 	fs.RemoveFile(wal_path);
@@ -450,4 +456,138 @@ void WriteAheadLog::Flush() {
 	wal_size = writer->GetFileSize();
 }
 
+void WriteAheadLog::FlushCommit() {
+	auto &config = DBConfig::Get(database);
+	auto commit_mode = config.options.wal_commit_mode;
+	if (commit_mode == WALCommitMode::SYNC || !writer) {
+		Flush();
+		return;
+	}
+	// write the flush marker and hand the data to the OS - but leave the fsync to SyncCommits
+	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
+	serializer.End();
+	writer->Flush();
+	wal_size = writer->GetFileSize();
+	++flushed_commits;
+
+	if (commit_mode == WALCommitMode::RELAXED) {
+		// relaxed durability: the commit does not wait for the sync, but we sync if the last sync is too long ago
+		auto sync_interval = std::chrono::milliseconds(config.options.wal_relaxed_sync_interval);
+		unique_lock<mutex> guard(sync_lock);
+		if (sync_in_progress || steady_clock::now() - last_sync < sync_interval) {
+			// the sync thread syncs this commit if no other commit does so within the interval
+			StartRelaxedSyncThread();
+			return;
+		}
+		sync_in_progress = true;
+		guard.unlock();
+		SyncFlushedCommits();
+	}
+}
+
+void WriteAheadLog::SyncCommits() {
+	SyncCommits(flushed_commits);
+}
+
+void WriteAheadLog::SyncCommits(idx_t target) {
+	auto commit_delay = DBConfig::Get(database).options.wal_commit_delay;
+	unique_lock<mutex> guard(sync_lock);
+	while (synced_commits < target) {
+		if (sync_in_progress) {
+			// another commit is syncing - wait for it to finish, its sync might already cover our entries
+			sync_finished.wait(guard);
+			continue;
+		}
+		// we become the leader and sync on behalf of all commits that have been flushed so far
+		sync_in_progress = true;
+		guard.unlock();
+		if (commit_delay > 0) {
+			// give concurrent commits the chance to write their entries so they can share this sync
+			std::this_thread::sleep_for(std::chrono::microseconds(commit_delay));
+		}
+		SyncFlushedCommits();
+		guard.lock();
+	}
+}
+
+void WriteAheadLog::SyncFlushedCommits() {
+	// any commit that was flushed before we start the sync is covered by it
+	idx_t sync_target = flushed_commits;
+	try {
+		lock_guard<mutex> lock(wal_lock);
+		if (writer) {
+			writer->handle->Sync();
+		}
+	} catch (std::exception &ex) {
+		{
+			lock_guard<mutex> guard(sync_lock);
+			sync_in_progress = false;
+		}
+		sync_finished.notify_all();
+		ErrorData error(ex);
+		throw FatalException("Failed to sync the write-ahead log: %s", error.RawMessage());
+	}
+	{
+		lock_guard<mutex> guard(sync_lock);
+		synced_commits = MaxValue<idx_t>(synced_commits, sync_target);
+		sync_in_progress = false;
+		last_sync = steady_clock::now();
+	}
+	sync_finished.notify_all();
+}
+
+void WriteAheadLog::StartRelaxedSyncThread() {
+#ifndef DUCKDB_NO_THREADS
+	if (relaxed_sync_thread || stop_relaxed_sync) {
+		return;
+	}
+	relaxed_sync_thread = make_uniq<thread>([this]() { RelaxedSyncLoop(); });
+#endif
+}
+
+void WriteAheadLog::RelaxedSyncLoop() {
+	auto stopped = [&]() {
+		return stop_relaxed_sync;
+	};
+	unique_lock<mutex> guard(sync_lock);
+	while (!stop_relaxed_sync) {
+		auto sync_interval = std::chrono::milliseconds(DBConfig::Get(database).options.wal_relaxed_sync_interval);
+		relaxed_sync_signal.wait_for(guard, sync_interval, stopped);
+		if (stop_relaxed_sync || sync_in_progress || synced_commits >= flushed_commits) {
+			continue;
+		}
+		if (steady_clock::now() - last_sync < sync_interval) {
+			// a commit synced in the mean time
+			continue;
+		}
+		sync_in_progress = true;
+		guard.unlock();
+		try {
+			SyncFlushedCommits();
+		} catch (std::exception &) {
+			// the sync state has been reset - the next commit that syncs runs into (and reports) the same error
+		}
+		guard.lock();
+	}
+}
+
+void WriteAheadLog::StopRelaxedSync() noexcept {
+	{
+		lock_guard<mutex> guard(sync_lock);
+		stop_relaxed_sync = true;
+		if (!relaxed_sync_thread) {
+			return;
+		}
+	}
+	relaxed_sync_signal.notify_all();
+	relaxed_sync_thread->join();
+	relaxed_sync_thread.reset();
+	// commits acknowledged before the database is closed are synced when closing it
+	try {
+		SyncCommits();
+	} catch (std::exception &) {
+		// the database is being closed - there is no client left to report the error to
+	}
+}
+
 } // namespace duckdb
@@ -1,9 +1,12 @@
 #include "duckdb/transaction/duck_transaction_manager.hpp"
 
 #include "duckdb/catalog/catalog_set.hpp"
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/error_data.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/printer.hpp"
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/dependency_manager.hpp"
@@ -13,10 +16,90 @@
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/parallel/task.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
+struct BackgroundCheckpointState {
+	//! Held while a background checkpoint is running
+	mutex lock;
+	//! The transaction manager - set to nullptr when the database is closed
+	optional_ptr<DuckTransactionManager> manager;
+	//! Whether a background checkpoint task is currently scheduled or running
+	atomic<bool> scheduled {false};
+	//! Protects the producer token
+	mutex token_lock;
+	//! The producer token used to schedule background checkpoint tasks - reset when the database is closed
+	unique_ptr<ProducerToken> token;
+	//! Whether scheduling new background checkpoints is still allowed
+	bool accepting_tasks = true;
+	//! Signalled when the database is closed, wakes up a task that is waiting to retry
+	std::condition_variable stop_signal;
+	//! Whether the database is being closed (protected by "lock")
+	bool stopping = false;
+	//! Set when the last background checkpoint failed
+	atomic<bool> failed {false};
+};
+
+class BackgroundCheckpointTask : public Task {
+public:
+	explicit BackgroundCheckpointTask(shared_ptr<BackgroundCheckpointState> state_p) : state(std::move(state_p)) {
+	}
+
+	//! How often a checkpoint that could not obtain the checkpoint lock is retried, and the initial/maximum backoff
+	static constexpr idx_t MAX_RETRIES = 10;
+	static constexpr int64_t INITIAL_BACKOFF_MS = 10;
+	static constexpr int64_t MAX_BACKOFF_MS = 1000;
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		unique_lock<mutex> guard(state->lock);
+		auto result = Run(guard);
+		state->scheduled = false;
+		return result;
+	}
+
+private:
+	TaskExecutionResult Run(unique_lock<mutex> &guard) {
+		int64_t backoff_ms = INITIAL_BACKOFF_MS;
+		const int64_t max_backoff_ms = MAX_BACKOFF_MS;
+		for (idx_t attempt = 0;; attempt++) {
+			if (!state->manager) {
+				// the database was closed in the mean time
+				return TaskExecutionResult::TASK_FINISHED;
+			}
+			try {
+				if (state->manager->BackgroundCheckpoint()) {
+					state->failed = false;
+					return TaskExecutionResult::TASK_FINISHED;
+				}
+			} catch (std::exception &ex) {
+				ErrorData error(ex);
+				Printer::Print("Background checkpoint of database \"" + state->manager->GetDB().GetName() +
+				               "\" failed: " + error.Message());
+				state->failed = true;
+				return TaskExecutionResult::TASK_ERROR;
+			}
+			if (attempt + 1 >= MAX_RETRIES) {
+				// give up - the next commit that pushes the WAL over the threshold schedules a new checkpoint
+				return TaskExecutionResult::TASK_FINISHED;
+			}
+			// the checkpoint lock is held by a writer: wait (or until the database is closed) and try again
+			auto stopping = [&]() {
+				return state->stopping;
+			};
+			state->stop_signal.wait_for(guard, std::chrono::milliseconds(backoff_ms), stopping);
+			backoff_ms = MinValue<int64_t>(backoff_ms * 2, max_backoff_ms);
+		}
+	}
+
+private:
+	shared_ptr<BackgroundCheckpointState> state;
+};
+
 DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : TransactionManager(db) {
 	// start timestamp starts at two
 	current_start_timestamp = 2;
@@ -31,9 +114,12 @@ DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : Transacti
 		// Specifically the StorageManager of the DuckCatalog is relied on, with `db.GetStorageManager`
 		throw InternalException("DuckTransactionManager should only be created together with a DuckCatalog");
 	}
+	background_checkpoint_state = make_shared_ptr<BackgroundCheckpointState>();
+	background_checkpoint_state->manager = this;
 }
 
 DuckTransactionManager::~DuckTransactionManager() {
+	StopBackgroundCheckpoints();
 }
 
 DuckTransactionManager &DuckTransactionManager::Get(AttachedDatabase &db) {
@@ -51,7 +137,7 @@ Transaction &DuckTransactionManager::StartTransaction(ClientContext &context) {
 	if (!meta_transaction.IsReadOnly()) {
 		start_lock = make_uniq<lock_guard<mutex>>(start_transaction_lock);
 	}
-	lock_guard<mutex> lock(transaction_lock);
+	unique_lock<mutex> lock(transaction_lock);
 	if (current_start_timestamp >= TRANSACTION_ID_START) { // LCOV_EXCL_START
 		throw InternalException("Cannot start more transactions, ran out of "
 		                        "transaction identifiers!");
@@ -71,6 +157,18 @@ Transaction &DuckTransactionManager::StartTransaction(ClientContext &context) {
 
 	// store it in the set of active transactions
 	active_transactions.push_back(std::move(transaction));
+
+	// in group commit mode commits become visible before their WAL entries are synced - any commit this transaction
+	// can see has been written to the WAL by now, wait for those to be synced so nothing is read before it is durable
+	if (DBConfig::GetConfig(db.GetDatabase()).options.wal_commit_mode == WALCommitMode::GROUP) {
+		auto wal = db.GetStorageManager().GetWAL();
+		if (wal) {
+			auto sync_target = wal->GetFlushedCommits();
+			lock.unlock();
+			start_lock.reset();
+			wal->SyncCommits(sync_target);
+		}
+	}
 	return transaction_ref;
 }
 
@@ -104,6 +202,14 @@ DuckTransactionManager::CanCheckpoint(DuckTransaction &transaction, unique_ptr<S
 	if (config.options.debug_skip_checkpoint_on_commit) {
 		return CheckpointDecision("checkpointing on commit disabled through configuration");
 	}
+	// after a failed background checkpoint the next one runs in the foreground, so that the error reaches a client
+	if (config.options.checkpoint_in_background && CanCheckpointInBackground() &&
+	    !background_checkpoint_state->failed.exchange(false)) {
+		// write the commit to the WAL as usual and let a background thread checkpoint afterwards
+		CheckpointDecision decision("automatic checkpoint deferred to a background thread");
+		decision.background_checkpoint = true;
+		return decision;
+	}
 	// try to lock the checkpoint lock
 	lock = transaction.TryGetCheckpointLock();
 	if (!lock) {
@@ -197,6 +303,70 @@ void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 	storage_manager.CreateCheckpoint(options);
 }
 
+bool DuckTransactionManager::CanCheckpointInBackground() {
+	auto &config = DBConfig::GetConfig(db.GetDatabase());
+	auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+	// we can only defer the checkpoint if there are background threads that will pick up the task
+	return NumericCast<idx_t>(scheduler.NumberOfThreads()) > config.options.external_threads;
+}
+
+void DuckTransactionManager::ScheduleBackgroundCheckpoint() {
+	auto &state = *background_checkpoint_state;
+	if (state.scheduled.exchange(true)) {
+		// a background checkpoint is already scheduled
+		return;
+	}
+	lock_guard<mutex> guard(state.token_lock);
+	if (!state.accepting_tasks) {
+		return;
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+	if (!state.token) {
+		state.token = scheduler.CreateProducer();
+	}
+	scheduler.ScheduleTask(*state.token, make_shared_ptr<BackgroundCheckpointTask>(background_checkpoint_state));
+}
+
+bool DuckTransactionManager::BackgroundCheckpoint() {
+	auto &storage_manager = db.GetStorageManager();
+	// the commit that scheduled this task already decided a checkpoint is needed (its estimate includes data that was
+	// written to blocks directly, which the WAL size does not reflect) - only skip it if the WAL has been truncated
+	if (storage_manager.InMemory() || storage_manager.GetWALSize() == 0) {
+		// another checkpoint has happened since this task was scheduled
+		return true;
+	}
+	// we do not wait for the checkpoint lock while holding up the writers - the caller retries with a backoff
+	auto lock = checkpoint_lock.TryGetExclusiveLock();
+	if (!lock) {
+		return false;
+	}
+	CheckpointOptions options;
+	if (GetLastCommit() > LowestActiveStart()) {
+		// we cannot do a full checkpoint if any transaction needs to read old data
+		options.type = CheckpointType::CONCURRENT_CHECKPOINT;
+	}
+	storage_manager.CreateCheckpoint(options);
+	return true;
+}
+
+void DuckTransactionManager::StopBackgroundCheckpoints() {
+	if (!background_checkpoint_state) {
+		return;
+	}
+	auto &state = *background_checkpoint_state;
+	{
+		lock_guard<mutex> guard(state.token_lock);
+		state.accepting_tasks = false;
+		// the token must not outlive the task scheduler, tasks that are still queued can be dequeued without it
+		state.token.reset();
+	}
+	// grabbing the lock waits for any running background checkpoint to finish, a task waiting to retry is woken up
+	lock_guard<mutex> guard(state.lock);
+	state.stopping = true;
+	state.manager = nullptr;
+	state.stop_signal.notify_all();
+}
+
 unique_ptr<StorageLockKey> DuckTransactionManager::SharedCheckpointLock() {
 	return checkpoint_lock.GetSharedLock();
 }
@@ -279,6 +449,11 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		lock.reset();
 	}
 
+	// in group commit mode the commit is only durable once the WAL has been synced - which we do after unlocking
+	// transactions that start in the mean time and can see the commit wait for this sync (see StartTransaction)
+	bool sync_wal = held_wal_lock && !error.HasError() &&
+	                DBConfig::GetConfig(db.GetDatabase()).options.wal_commit_mode == WALCommitMode::GROUP;
+
 	// commit successful: remove the transaction id from the list of active transactions
 	// potentially resulting in garbage collection
 	bool store_transaction = undo_properties.has_updates || undo_properties.has_catalog_changes || error.HasError();
@@ -295,6 +470,17 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		options.type = checkpoint_decision.type;
 		auto &storage_manager = db.GetStorageManager();
 		storage_manager.CreateCheckpoint(options);
+	} else if (checkpoint_decision.background_checkpoint) {
+		ScheduleBackgroundCheckpoint();
+	}
+	if (sync_wal) {
+		// release our locks so that concurrent commits can write their WAL entries and share the sync with us
+		tlock.unlock();
+		held_wal_lock.reset();
+		auto wal = db.GetStorageManager().GetWAL();
+		if (wal) {
+			wal->SyncCommits();
+		}
 	}
 	return error;
 }
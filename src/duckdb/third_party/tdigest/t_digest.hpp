@@ -128,8 +128,8 @@ public:
 	TDigest(Value compression, Index unmergedSize, Index mergedSize)
 	    : compression_(compression), maxProcessed_(processedSize(mergedSize, compression)),
 	      maxUnprocessed_(unprocessedSize(unmergedSize, compression)) {
-		processed_.reserve(maxProcessed_);
-		unprocessed_.reserve(maxUnprocessed_ + 1);
+		// The buffers are not reserved up front:
+		// window segment trees keep a digest for every few rows, most of which stay small
 	}
 
 	TDigest(std::vector<Centroid> &&processed, std::vector<Centroid> &&unprocessed, Value compression,
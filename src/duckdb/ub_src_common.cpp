@@ -40,6 +40,8 @@
 
 #include "src/common/local_file_system.cpp"
 
+#include "src/common/multi_file_index.cpp"
+
 #include "src/common/multi_file_list.cpp"
 
 #include "src/common/multi_file_reader.cpp"
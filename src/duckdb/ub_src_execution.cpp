@@ -1,5 +1,7 @@
 #include "src/execution/adaptive_filter.cpp"
 
+#include "src/execution/adaptive_join_order.cpp"
+
 #include "src/execution/aggregate_hashtable.cpp"
 
 #include "src/execution/base_aggregate_hashtable.cpp"
@@ -12,6 +12,8 @@
 
 #include "src/execution/expression_executor/execute_function.cpp"
 
+#include "src/execution/expression_executor/execute_fused.cpp"
+
 #include "src/execution/expression_executor/execute_operator.cpp"
 
 #include "src/execution/expression_executor/execute_parameter.cpp"
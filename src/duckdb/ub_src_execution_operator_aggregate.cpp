@@ -10,6 +10,8 @@
 
 #include "src/execution/operator/aggregate/physical_perfecthash_aggregate.cpp"
 
+#include "src/execution/operator/aggregate/physical_streaming_aggregate.cpp"
+
 #include "src/execution/operator/aggregate/physical_ungrouped_aggregate.cpp"
 
 #include "src/execution/operator/aggregate/physical_window.cpp"
@@ -16,6 +16,8 @@
 
 #include "src/execution/operator/join/physical_iejoin.cpp"
 
+#include "src/execution/operator/join/physical_index_join.cpp"
+
 #include "src/execution/operator/join/physical_join.cpp"
 
 #include "src/execution/operator/join/physical_nested_loop_join.cpp"
@@ -18,6 +18,8 @@
 
 #include "src/function/table/system/duckdb_optimizers.cpp"
 
+#include "src/function/table/system/duckdb_plan_cache.cpp"
+
 #include "src/function/table/system/duckdb_schemas.cpp"
 
 #include "src/function/table/system/duckdb_secrets.cpp"
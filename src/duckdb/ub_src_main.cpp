@@ -40,6 +40,8 @@
 
 #include "src/main/pending_query_result.cpp"
 
+#include "src/main/plan_cache.cpp"
+
 #include "src/main/prepared_statement.cpp"
 
 #include "src/main/prepared_statement_data.cpp"
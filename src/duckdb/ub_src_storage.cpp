@@ -18,6 +18,8 @@
 
 #include "src/storage/magic_bytes.cpp"
 
+#include "src/storage/object_cache.cpp"
+
 #include "src/storage/storage_manager.cpp"
 
 #include "src/storage/standard_buffer_manager.cpp"
@@ -22,3 +22,5 @@
 
 #include "src/storage/compression/fsst.cpp"
 
+#include "src/storage/compression/zstd.cpp"
+